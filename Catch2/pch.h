@@ -11,3 +11,15 @@
 #pragma warning( pop )
 
 #include "../Chamois/Chamois.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <list>
+#include <ranges>
+#include <set>
+#include <span>
+#include <sstream>
+#include <string_view>
+#include <thread>
+#include <unordered_set>
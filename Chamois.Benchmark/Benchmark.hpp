@@ -0,0 +1,73 @@
+#pragma once
+
+/*
+ *    Per assertion cost of Chamois against each backend, and of the raw framework macros it wraps.
+ *    Every case is run for CHAMOIS_BENCHMARK_ITERATIONS iterations (failing cases for a tenth of that),
+ *    then reported as nanoseconds and global operator new calls per assertion.
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+
+namespace evolutional::benchmark
+{
+///
+/// Number of global operator new calls so far, counted by AllocationCounter.cpp
+std::size_t AllocationCount() noexcept;
+
+template <typename T> void DoNotOptimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static const void* volatile sink;
+    sink = &value;
+#endif
+}
+
+inline void ClobberMemory()
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : : "memory");
+#endif
+}
+
+inline std::size_t Iterations(const bool failing)
+{
+    std::size_t iterations = 100000;
+    if (const char* value = std::getenv("CHAMOIS_BENCHMARK_ITERATIONS"); value != nullptr)
+    {
+        iterations = std::strtoul(value, nullptr, 10);
+    }
+    // A failing assertion is reported (and usually recorded) by the framework, so is far slower
+    return failing ? (iterations / 10 > 0 ? iterations / 10 : 1) : (iterations > 0 ? iterations : 1);
+}
+
+inline void PrintHeader(const char* backend)
+{
+    std::printf("\n%-8s %-36s %-6s %12s %12s\n", backend, "case", "path", "ns/assert", "allocs/assert");
+}
+
+template <typename TBody> void Measure(const char* backend, const char* name, const bool failing, TBody&& body)
+{
+    const std::size_t iterations = Iterations(failing);
+    // Once untimed, so first use statics (e.g. the GTest throw listener) are not counted
+    body();
+
+    const std::size_t allocations = AllocationCount();
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        body();
+        ClobberMemory();
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    const std::size_t allocated = AllocationCount() - allocations;
+
+    const double ns = std::chrono::duration<double, std::nano>(stop - start).count() / static_cast<double>(iterations);
+    std::printf("%-8s %-36s %-6s %12.1f %12.2f\n", backend, name, failing ? "fail" : "pass", ns,
+        static_cast<double>(allocated) / static_cast<double>(iterations));
+}
+}    // namespace evolutional::benchmark
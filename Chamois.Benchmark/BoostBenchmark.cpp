@@ -0,0 +1,55 @@
+#define BOOST_TEST_MODULE ChamoisBenchmark
+#include <boost/test/included/unit_test.hpp>
+
+#include "Chamois.hpp"
+
+#include "Benchmark.hpp"
+#include "Verbs.hpp"
+
+using namespace evolutional;
+
+namespace
+{
+void RunBenchmarks(const bool failing)
+{
+    const int number = 10;
+    const int expected_number = failing ? 11 : 10;
+    const std::string text = "hello world";
+    const std::string expected_text = failing ? "hello there" : "hello world";
+    benchmark::DoNotOptimize(number);
+    benchmark::DoNotOptimize(expected_number);
+
+    // BOOST_REQUIRE_* throws execution_aborted on failure; catch it so the loop carries on
+    const auto guard = [](auto&& verb) {
+        try
+        {
+            verb();
+        }
+        catch (const boost::execution_aborted&)
+        {
+        }
+    };
+
+    benchmark::PrintHeader("boost");
+    benchmark::Measure("boost", "BOOST_REQUIRE_EQUAL(int)", failing,
+        [&] { guard([&] { BOOST_REQUIRE_EQUAL(expected_number, number); }); });
+    benchmark::Measure("boost", "BOOST_REQUIRE_EQUAL(string)", failing,
+        [&] { guard([&] { BOOST_REQUIRE_EQUAL(expected_text, text); }); });
+    benchmark::RunChamoisVerbs("boost", failing, guard);
+}
+}    // namespace
+
+BOOST_AUTO_TEST_CASE(Passing)
+{
+    RunBenchmarks(false);
+}
+
+// A failed BOOST_REQUIRE_* marks the test case as aborted even when execution_aborted is caught, so this case
+// always fails; run it with `--result_code=no --report_level=no` (as ctest does) when the exit code matters.
+BOOST_AUTO_TEST_CASE(Failing)
+{
+    // Keep the failure log out of the benchmark table (and out of the timings)
+    boost::unit_test::unit_test_log.set_threshold_level(boost::unit_test::log_nothing);
+    RunBenchmarks(true);
+    boost::unit_test::unit_test_log.set_threshold_level(boost::unit_test::log_all_errors);
+}
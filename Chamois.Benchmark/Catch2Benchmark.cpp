@@ -0,0 +1,66 @@
+#include "catch_amalgamated.hpp"
+#include <vector>
+
+#include "Chamois.hpp"
+
+#include "Benchmark.hpp"
+#include "Verbs.hpp"
+
+using namespace evolutional;
+
+namespace
+{
+void RunBenchmarks(const bool failing)
+{
+    const int number = 10;
+    const int expected_number = failing ? 11 : 10;
+    const std::string text = "hello world";
+    const std::string expected_text = failing ? "hello there" : "hello world";
+    benchmark::DoNotOptimize(number);
+    benchmark::DoNotOptimize(expected_number);
+
+    // REQUIRE throws TestFailureException on failure; catch it so the loop carries on
+    const auto guard = [](auto&& verb) {
+        try
+        {
+            verb();
+        }
+        catch (const Catch::TestFailureException&)
+        {
+        }
+    };
+
+    benchmark::PrintHeader("catch2");
+    benchmark::Measure("catch2", "REQUIRE(int ==)", failing,
+        [&] { guard([&] { REQUIRE(number == expected_number); }); });
+    benchmark::Measure("catch2", "REQUIRE(string ==)", failing,
+        [&] { guard([&] { REQUIRE(text == expected_text); }); });
+    benchmark::RunChamoisVerbs("catch2", failing, guard);
+}
+}    // namespace
+
+TEST_CASE("Passing", "[benchmark]")
+{
+    RunBenchmarks(false);
+}
+
+TEST_CASE("Failing", "[benchmark][!mayfail]")
+{
+    RunBenchmarks(true);
+}
+
+int main(int argc, char* argv[])
+{
+    // Catch2 reports every failure of the "Failing" case; send its output to the null device so that
+    // only the benchmark table is printed
+#ifdef _WIN32
+    char null_device[] = "NUL";
+#else
+    char null_device[] = "/dev/null";
+#endif
+    char out[] = "--out";
+    std::vector<char*> args(argv, argv + argc);
+    args.push_back(out);
+    args.push_back(null_device);
+    return Catch::Session().run(static_cast<int>(args.size()), args.data());
+}
@@ -0,0 +1,65 @@
+# cmake -DOBJDUMP=<objdump> -DOBJECTS=<Codegen object> [-DMAX_INSTRUCTIONS=<n>] -P CheckCodegen.cmake
+# Disassembles every chamois_codegen_* function in the object and fails if the passing path of any of them
+# is more than the comparison and a branch (and a return), or calls anything; the failure path is in a separate .cold part.
+if(NOT DEFINED MAX_INSTRUCTIONS)
+    # compare, branch, return, plus one register move the compiler may schedule alongside
+    set(MAX_INSTRUCTIONS 4)
+endif()
+
+execute_process(COMMAND ${OBJDUMP} -d --no-show-raw-insn ${OBJECTS}
+    OUTPUT_VARIABLE disassembly RESULT_VARIABLE result)
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "${OBJDUMP} failed on ${OBJECTS}")
+endif()
+
+string(REPLACE "\n" ";" lines "${disassembly}")
+set(function "")
+set(functions "")
+set(failed FALSE)
+
+macro(check_function)
+    if(function)
+        list(LENGTH instructions count)
+        string(REPLACE ";" "\n    " listing "${instructions}")
+        if(count GREATER MAX_INSTRUCTIONS OR calls)
+            message(SEND_ERROR "${function}: ${count} instructions (at most ${MAX_INSTRUCTIONS}, no calls)\n    ${listing}")
+            set(failed TRUE)
+        else()
+            message(STATUS "${function}: ${count} instructions\n    ${listing}")
+        endif()
+    endif()
+endmacro()
+
+foreach(line IN LISTS lines)
+    if(line MATCHES "^[0-9a-f]+ <([A-Za-z0-9_.]+)>:$")
+        set(symbol ${CMAKE_MATCH_1})
+        check_function()
+        set(function "")
+        # Skip the `.cold` failure parts
+        if(symbol MATCHES "^chamois_codegen_[a-z_]+$")
+            set(function ${symbol})
+            list(APPEND functions ${function})
+            set(instructions "")
+            set(calls FALSE)
+        endif()
+    elseif(function AND line MATCHES "^ +[0-9a-f]+:\t([a-z0-9.]+)(.*)$")
+        set(mnemonic ${CMAKE_MATCH_1})
+        string(STRIP "${CMAKE_MATCH_1}${CMAKE_MATCH_2}" instruction)
+        # Alignment padding after the return
+        if(mnemonic MATCHES "^(nop|nopw|nopl|xchg|int3|data16|cs)$")
+            continue()
+        endif()
+        if(mnemonic MATCHES "^(call|callq|bl|blr)$")
+            set(calls TRUE)
+        endif()
+        list(APPEND instructions "${instruction}")
+    endif()
+endforeach()
+check_function()
+
+if(NOT functions)
+    message(FATAL_ERROR "No chamois_codegen_* functions found in ${OBJECTS}")
+endif()
+if(failed)
+    message(FATAL_ERROR "The passing path of an assertion is not just a comparison and a branch")
+endif()
@@ -0,0 +1,60 @@
+// Passing assertions whose optimised code CheckCodegen.cmake inspects; nothing here is ever run.
+// Built once per backend, selected by CHAMOIS_CODEGEN_GTEST / CHAMOIS_CODEGEN_BOOST / CHAMOIS_CODEGEN_CATCH2.
+
+#if defined(CHAMOIS_CODEGEN_GTEST)
+#include <gtest/gtest.h>
+#elif defined(CHAMOIS_CODEGEN_BOOST)
+#define BOOST_TEST_MODULE ChamoisCodegen
+#include <boost/test/unit_test.hpp>
+#else
+#include "catch_amalgamated.hpp"
+#endif
+#include <string_view>
+
+#include "Chamois.hpp"
+
+using namespace evolutional;
+
+// Each is expected to be the comparison and a branch to the (cold) failure path, then a return
+extern "C"
+{
+void chamois_codegen_int_be(const int actual, const int expected)
+{
+    Assert::That(actual).Should().Be(expected, "numbers are equal");
+}
+
+void chamois_codegen_int_not_be(const int actual, const int expected)
+{
+    Assert::That(actual).Should().NotBe(expected, "numbers differ");
+}
+
+void chamois_codegen_int_be_in_range(const int actual)
+{
+    Assert::That(actual).Should().BeInRange(1, 9, "number is in range");
+}
+
+void chamois_codegen_long_be_greater_than(const long actual, const long expected)
+{
+    Assert::That(actual).Should().BeGreaterThan(expected, "number is greater");
+}
+
+void chamois_codegen_double_be_less_than(const double actual, const double expected)
+{
+    Assert::That(actual).Should().BeLessThan(expected, "real is less");
+}
+
+void chamois_codegen_bool_be_true(const bool actual)
+{
+    Assert::That(actual).Should().BeTrue("flag is set");
+}
+
+void chamois_codegen_ptr_not_be_null(const void* actual)
+{
+    Assert::ThatPtr(actual).Should().NotBeNull("pointer is set");
+}
+
+void chamois_codegen_string_have_length(const char* data, const std::size_t size, const std::size_t expected)
+{
+    Assert::That(std::string_view(data, size)).Should().HaveLength(expected, "string has the length");
+}
+}
@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+#include <gtest/gtest-spi.h>
+#define GTEST_INCLUDE_GTEST_GTEST_H_
+#include "Chamois.hpp"
+
+#include "Benchmark.hpp"
+#include "Verbs.hpp"
+
+using namespace evolutional;
+
+namespace
+{
+void RawEqual(const int expected_value, const int actual_value)
+{
+    ASSERT_EQ(expected_value, actual_value) << "numbers are equal";
+}
+
+void RawEqual(const std::string& expected_value, const std::string& actual_value)
+{
+    ASSERT_EQ(expected_value, actual_value) << "strings are equal";
+}
+
+void RunBenchmarks(const bool failing)
+{
+    const int number = 10;
+    const int expected_number = failing ? 11 : 10;
+    const std::string text = "hello world";
+    const std::string expected_text = failing ? "hello there" : "hello world";
+    benchmark::DoNotOptimize(number);
+    benchmark::DoNotOptimize(expected_number);
+
+    benchmark::PrintHeader("gtest");
+    benchmark::Measure("gtest", "ASSERT_EQ(int)", failing, [&] { RawEqual(expected_number, number); });
+    benchmark::Measure("gtest", "ASSERT_EQ(string)", failing, [&] { RawEqual(expected_text, text); });
+    // A failed ASSERT_* returns from the enclosing function, so the verbs need no guard
+    benchmark::RunChamoisVerbs("gtest", failing, [](auto&& verb) { verb(); });
+}
+}    // namespace
+
+TEST(ChamoisBenchmark, Passing)
+{
+    RunBenchmarks(false);
+}
+
+TEST(ChamoisBenchmark, Failing)
+{
+    // Intercepts the failures before they reach the listeners (including the Chamois throw listener),
+    // so the failing path is measured without failing this test
+    testing::TestPartResultArray failures;
+    {
+        testing::ScopedFakeTestPartResultReporter reporter(
+            testing::ScopedFakeTestPartResultReporter::INTERCEPT_ONLY_CURRENT_THREAD, &failures);
+        RunBenchmarks(true);
+    }
+    Assert::That(failures.size()).Should().BeGreaterThan(0, "every failing case reports a failure");
+}
@@ -0,0 +1,189 @@
+#pragma once
+
+/*
+ *    The Chamois verbs measured for every backend; include after Chamois.hpp.
+ *    TGuard runs one assertion, absorbing however the backend aborts a failing one.
+ */
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+
+namespace evolutional::benchmark
+{
+inline void Throws()
+{
+    throw std::runtime_error("thrown");
+}
+
+inline void DoesNotThrow()
+{
+}
+
+template <typename TGuard> void RunChamoisVerbs(const char* backend, const bool failing, TGuard&& guard)
+{
+    const int number = 10;
+    const int expected_number = failing ? 11 : 10;
+    const int range_min = failing ? 11 : 5;
+    const double real = 2.4;
+    const double expected_real = failing ? 3.4 : 2.5;
+    const bool flag = !failing;
+    const std::string text = "hello world";
+    const std::string expected_text = failing ? "hello there" : "hello world";
+    const std::wstring wide_text = L"hello world";
+    const std::wstring expected_wide_text = failing ? L"hello there" : L"hello world";
+    const std::string prefix = failing ? "world" : "hello";
+    const size_t text_length = failing ? 5 : 11;
+    const std::string log_line = "2023-06-14 12:00:03 INFO request id=42 done";
+    const char* const log_pattern = failing ? R"(.* ERROR .*)" : R"(\d{4}-\d{2}-\d{2} [\d:]+ [A-Z]+ .*id=\d+.*)";
+    const char* const log_wildcard = failing ? "* ERROR *" : "2023-06-?? ??:??:?? * request id=* done";
+    // A 1 MiB document, when failing with its last character changed
+    const std::string document(1024 * 1024, 'x');
+    std::string expected_document = document;
+    expected_document.back() = failing ? 'y' : 'x';
+    const int array[5] = { 1, 2, 3, 4, 5 };
+    const int expected_array[5] = { 1, 2, 3, 4, failing ? 6 : 5 };
+    const std::vector<int> vector = { 1, 2, 3, 4, 5 };
+    const std::vector<int> expected_vector = { 1, 2, 3, 4, failing ? 6 : 5 };
+    // Large buffers that differ, when failing, only in their last byte
+    static std::uint8_t block[64 * 1024];
+    static std::uint8_t expected_block[64 * 1024];
+    expected_block[sizeof(expected_block) - 1] = failing ? 1 : 0;
+    std::vector<std::uint8_t> buffer(1024 * 1024);
+    std::vector<std::uint8_t> expected_buffer(1024 * 1024);
+    expected_buffer.back() = failing ? 1 : 0;
+    // The same, as files
+    const auto file = std::filesystem::temp_directory_path() / "chamois_benchmark_file.bin";
+    const auto expected_file = std::filesystem::temp_directory_path() / "chamois_benchmark_expected_file.bin";
+    std::ofstream(file, std::ios::binary)
+        .write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+    std::ofstream(expected_file, std::ios::binary)
+        .write(reinterpret_cast<const char*>(expected_buffer.data()), static_cast<std::streamsize>(expected_buffer.size()));
+    // The same 64 Ki ids in reverse order, when failing one of them is replaced
+    std::vector<int> ids(64 * 1024);
+    std::vector<int> expected_ids(ids.size());
+    for (size_t id = 0; id < ids.size(); ++id)
+    {
+        ids[id] = static_cast<int>(id);
+        expected_ids[ids.size() - 1 - id] = static_cast<int>(id);
+    }
+    expected_ids.front() = failing ? -1 : expected_ids.front();
+    const int last_id = failing ? -1 : static_cast<int>(ids.size()) - 1;
+    std::vector<int> some_ids;
+    for (int id = 0; id < static_cast<int>(ids.size()); id += 64)
+    {
+        some_ids.push_back(id);
+    }
+    some_ids.back() = failing ? -1 : some_ids.back();
+    // 64 Ki random keys in reverse order, when failing none of them are expected
+    std::mt19937_64 random(42);
+    std::vector<long long> keys(64 * 1024);
+    for (auto& key : keys)
+    {
+        key = static_cast<long long>(random());
+    }
+    std::vector<long long> expected_keys(keys.rbegin(), keys.rend());
+    for (auto& key : expected_keys)
+    {
+        key = failing ? static_cast<long long>(random()) : key;
+    }
+    const std::unique_ptr<int> pointer = failing ? nullptr : std::make_unique<int>(1);
+    void (*const function)() = failing ? &DoesNotThrow : &Throws;
+    DoNotOptimize(number);
+    DoNotOptimize(expected_number);
+    DoNotOptimize(real);
+    DoNotOptimize(flag);
+
+    Measure(backend, "Chamois That(int).Be", failing, [&] {
+        guard([&] { Assert::That(number).Should().Be(expected_number, "numbers are equal"); });
+    });
+    Measure(backend, "Chamois That(int).NotBe", failing, [&] {
+        guard([&] { Assert::That(number).Should().NotBe(failing ? number : 5, "numbers are not equal"); });
+    });
+    Measure(backend, "Chamois That(int).BeInRange", failing, [&] {
+        guard([&] { Assert::That(number).Should().BeInRange(range_min, 20, "number is in range"); });
+    });
+    Measure(backend, "Chamois That(double).BeApproximately", failing, [&] {
+        guard([&] { Assert::That(real).Should().BeApproximately(expected_real, 0.2, "reals are close"); });
+    });
+    Measure(backend, "Chamois That(bool).BeTrue", failing, [&] {
+        guard([&] { Assert::That(flag).Should().BeTrue("flag is set"); });
+    });
+    Measure(backend, "Chamois That(string).Be", failing, [&] {
+        guard([&] { Assert::That(text).Should().Be(expected_text, "strings are equal"); });
+    });
+    Measure(backend, "Chamois That(wstring).Be", failing, [&] {
+        guard([&] { Assert::That(wide_text).Should().Be(expected_wide_text, "wide strings are equal"); });
+    });
+    Measure(backend, "Chamois That(string).Be (1 MiB)", failing, [&] {
+        guard([&] { Assert::That(document).Should().Be(expected_document, "documents are equal"); });
+    });
+    Measure(backend, "Chamois That(string).BeEquivalentToIgnoringCase (1 MiB)", failing, [&] {
+        guard([&] { Assert::That(document).Should().BeEquivalentToIgnoringCase(expected_document, "documents are equal"); });
+    });
+    Measure(backend, "Chamois That(string).HaveLength", failing, [&] {
+        guard([&] { Assert::That(text).Should().HaveLength(text_length, "string has the length"); });
+    });
+    Measure(backend, "Chamois That(string).StartWith", failing, [&] {
+        guard([&] { Assert::That(text).Should().StartWith(prefix, "string has the prefix"); });
+    });
+    Measure(backend, "Chamois That(string).MatchRegex", failing, [&] {
+        guard([&] { Assert::That(log_line).Should().MatchRegex(log_pattern, "the line is well formed"); });
+    });
+    Measure(backend, "Chamois That(string).MatchWildcard", failing, [&] {
+        guard([&] { Assert::That(log_line).Should().MatchWildcard(log_wildcard, "the line is well formed"); });
+    });
+    Measure(backend, "Chamois ThatArray.Be", failing, [&] {
+        guard([&] { Assert::ThatArray(array).Should().Be(expected_array, "arrays are equal"); });
+    });
+    Measure(backend, "Chamois ThatContainer.Be", failing, [&] {
+        guard([&] { Assert::ThatContainer(vector).Should().Be(expected_vector, "vectors are equal"); });
+    });
+    Measure(backend, "Chamois ThatArray.Be (64 KiB)", failing, [&] {
+        guard([&] { Assert::ThatArray(block).Should().Be(expected_block, "blocks are equal"); });
+    });
+    Measure(backend, "Chamois ThatContainer.Be (1 MiB)", failing, [&] {
+        guard([&] { Assert::ThatContainer(buffer).Should().Be(expected_buffer, "buffers are equal"); });
+    });
+    Measure(backend, "Chamois ThatRange(span).Be (1 MiB)", failing, [&] {
+        guard([&] { Assert::ThatRange(std::span(buffer)).Should().Be(expected_buffer, "buffers are equal"); });
+    });
+    Measure(backend, "Chamois ThatFile.HaveSameContentAs (1 MiB)", failing, [&] {
+        guard([&] { Assert::ThatFile(file).Should().HaveSameContentAs(expected_file, "files are equal"); });
+    });
+    Measure(backend, "Chamois ThatContainer.BeEquivalentTo (64 Ki)", failing, [&] {
+        guard([&] { Assert::ThatContainer(ids).Should().BeEquivalentTo(expected_ids, "the same ids"); });
+    });
+    Measure(backend, "Chamois ThatContainer.BeEquivalentTo (64 Ki random)", failing, [&] {
+        guard([&] { Assert::ThatContainer(keys).Should().BeEquivalentTo(expected_keys, "the same keys"); });
+    });
+    Measure(backend, "Chamois ThatContainer.Contain (64 Ki)", failing, [&] {
+        guard([&] { Assert::ThatContainer(ids).Should().Contain(last_id, "the last id"); });
+    });
+    Measure(backend, "Chamois ThatContainer.ContainAll (64 Ki, 1 Ki)", failing, [&] {
+        guard([&] { Assert::ThatContainer(expected_ids).Should().ContainAll(some_ids, "every 64th id"); });
+    });
+    Measure(backend, "Chamois ThatContainer.BeInAscendingOrder (64 Ki)", failing, [&] {
+        guard([&] { Assert::ThatContainer(failing ? expected_ids : ids).Should().BeInAscendingOrder("ids are sorted"); });
+    });
+    Measure(backend, "Chamois ThatContainer.HaveLength", failing, [&] {
+        guard([&] { Assert::ThatContainer(vector).Should().HaveLength(failing ? 4 : 5, "vector has the length"); });
+    });
+    Measure(backend, "Chamois ThatPtr.NotBeNull", failing, [&] {
+        guard([&] { Assert::ThatPtr(pointer).Should().NotBeNull("pointer is set"); });
+    });
+    Measure(backend, "Chamois That(function).Throw", failing, [&] {
+        guard([&] { Assert::That(function).Should().Throw(std::runtime_error, "function throws"); });
+    });
+    std::filesystem::remove(file);
+    std::filesystem::remove(expected_file);
+}
+}    // namespace evolutional::benchmark
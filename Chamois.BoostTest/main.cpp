@@ -1,7 +1,19 @@
 #define BOOST_TEST_MODULE ChamoisTest
 #include <boost/test/included/unit_test.hpp>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
 #include <vector>
 #include <map>
+#include <list>
+#include <set>
+#include <ranges>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
+#include <unordered_set>
 
 #include "Chamois.hpp"
 
@@ -69,6 +81,27 @@ BOOST_AUTO_TEST_CASE(Chamois_Assert_NotEqual_char_10)
     Assert::That((char)10).Should().NotBe((char)5, "10 should be not equal to five");
 }
 
+BOOST_AUTO_TEST_CASE(Chamois_Assert_Equal_Pointer_Temporary)
+{
+    int value = 10;
+    Assert::That(&value).Should().Be(&value, "a pointer temporary is owned by the assertion");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_NotEqual_Pointer_Temporary)
+{
+    int value = 10;
+    Assert::That(&value).Should().NotBe(static_cast<int*>(nullptr), "a pointer temporary is not null");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_Temporary_Should_Stored)
+{
+    const std::filesystem::path expected("a/path/long/enough/to/be/allocated/rather/than/held/in/the/object");
+    auto should = Assert::That(std::filesystem::path("a/path/long/enough/to/be/allocated/rather/than/held/in/the/object")).Should();
+    should.Be(expected, "the stored subject owns its path");
+    const auto copy = should;
+    copy.NotBe(std::filesystem::path(), "a copy owns a copy of the path");
+}
+
 
 
 BOOST_AUTO_TEST_CASE(Chamois_Assert_Equal_float_2_4)
@@ -123,6 +156,39 @@ BOOST_AUTO_TEST_CASE(Chamois_Assert_String_StartsWith)
     Assert::That("hello").Should().StartWith("hel", "string should be starts with hel");
 }
 
+BOOST_AUTO_TEST_CASE(Chamois_Assert_Equal_String_Temporary)
+{
+    Assert::That(std::string("hello")).Should().Be(std::string("hello"), "temporary strings are equal");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_String_Temporary_Should_Stored)
+{
+    const auto make = [](const char* text) { return std::string(text); };
+    auto should = Assert::That(make("long enough to be allocated rather than held in the string object")).Should();
+    should.Be("long enough to be allocated rather than held in the string object", "the stored subject owns its string");
+    const auto copy = Assert::That(make("short")).Should();
+    auto copied = copy;
+    copied.Be("short", "a copy views its own string");
+    auto wide = Assert::That(std::wstring(L"a wide temporary that is long enough to be allocated")).Should();
+    wide.StartWith(L"a wide temporary", "wide subjects are owned too");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_StringView_HaveLength)
+{
+    const std::string_view A = "hello";
+    Assert::That(A).Should().HaveLength(5, "string view has a length of 5");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_WString_StartsWith)
+{
+    Assert::That(L"hello").Should().StartWith(L"hel", "wide string starts with hel");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_String_Empty)
+{
+    Assert::That(std::string()).Should().BeEmpty("default string is empty");
+}
+
 BOOST_AUTO_TEST_CASE(Chamois_Assert_NotEqual_Strings)
 {
     const wchar_t* A = L"hello";
@@ -130,6 +196,187 @@ BOOST_AUTO_TEST_CASE(Chamois_Assert_NotEqual_Strings)
     Assert::That(A).Should().NotBe(B, "strings should be not equal");
 }
 
+BOOST_AUTO_TEST_CASE(Chamois_Assert_String_Mismatch_Shows_Context)
+{
+    std::string expected;
+    for (int i = 0; i < 10000; ++i)
+    {
+        expected += "{ \"id\": " + std::to_string(i) + " },\n";
+    }
+    std::string actual = expected;
+    const size_t changed = expected.find("\"id\": 1234 ");
+    actual[changed + 9] = '5';
+    AssertionScope scope;
+    Assert::That(actual).Should().Be(expected, "one digit differs");
+    const std::string message = scope.Discard();
+    const std::string where = "Strings differ at index " + std::to_string(changed + 9) + " (line 1235, column 12)";
+    Assert::That(message.find(where) != std::string::npos).Should().Be(true, "the index, line and column are given");
+    Assert::That(message.find("\"id\": 1235 },\\n{ \"id\": 1235") != std::string::npos).Should().Be(true, "the context is shown, on one line");
+    Assert::That(message.length() < 500).Should().Be(true, "neither string is shown whole");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_WString_Mismatch_Shows_Context)
+{
+    const std::wstring expected(1000, L'a');
+    const std::wstring actual = expected + L"b";
+    AssertionScope scope;
+    Assert::That(actual).Should().Be(expected, "one more character");
+    const std::string message = scope.Discard();
+    Assert::That(message.find("Strings differ at index 1000 (line 1, column 1001): expected 1000 characters, found 1001") != std::string::npos).Should().Be(true, "where the shorter one ends");
+    Assert::That(message.find("aaab\n") != std::string::npos).Should().Be(true, "the extra character is shown");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_String_EndWith_And_Contain)
+{
+    const std::string log = "12:00:01 started\n12:00:02 connected to db\n12:00:03 request id=42 done\n12:00:04 stopped\n";
+    Assert::That(log).Should().EndWith("stopped\n", "the log ends with the stop");
+    Assert::That(std::wstring(L"hello world")).Should().EndWith(L"world", "wide string ends with world");
+    Assert::That(log).Should().Contain("request id=42", "the request was logged");
+    Assert::That(std::wstring(L"hello world")).Should().Contain(L"o w", "wide string contains o w");
+    Assert::That(log).Should().NotContain("error", "nothing failed");
+    Assert::That(log).Should().ContainAll({ "started", "connected", "stopped" }, "every stage was logged");
+    std::vector<std::string> markers;
+    for (int i = 0; i < 20; ++i)
+    {
+        markers.push_back("marker " + std::to_string(i) + ";");
+    }
+    std::string text;
+    for (int i = 19; i >= 0; --i)
+    {
+        text += "some text before marker " + std::to_string(i) + "; and after\n";
+    }
+    Assert::That(text).Should().ContainAll(markers, "the twenty markers are found in one pass");
+    Assert::That(log).Should().ContainInOrder({ "started", "connected", "request", "stopped" }, "the stages are in order");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_String_Contain_Reports)
+{
+    const std::string log = "12:00:01 started\n12:00:02 connected to db\n12:00:04 stopped\n";
+    AssertionScope scope;
+    Assert::That(log).Should().Contain("request", "no request was logged");
+    Assert::That(log).Should().NotContain("connected", "the connection is logged");
+    Assert::That(log).Should().ContainAll({ "started", "request", "retry" }, "two are missing");
+    Assert::That(log).Should().ContainInOrder({ "connected", "started" }, "started comes first");
+    Assert::That(log).Should().EndWith("started", "the log ends with the stop");
+    const int failures = static_cast<int>(scope.FailureCount());
+    const std::string message = scope.Discard();
+    Assert::That(failures).Should().Be(5, "every assertion fails");
+    Assert::That(message).Should().Contain("does not contain \"request\"", "the missing substring is named");
+    Assert::That(message).Should().Contain("contains \"connected\", first at index 26", "where the unwanted substring is");
+    Assert::That(message).Should().Contain("is missing 2 of 3 substrings: \"request\", \"retry\"", "the missing substrings are listed");
+    Assert::That(message).Should().Contain("\"started\" is not found after \"connected\"", "the first out of order substring is named");
+    Assert::That(message).Should().Contain("does not end with", "the suffix differs");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_String_MatchRegex)
+{
+    const std::string line = "2023-06-14 12:00:03 INFO request id=42 done";
+    Assert::That(line).Should().MatchRegex(R"(\d{4}-\d{2}-\d{2} [\d:]+ [A-Z]+ .*id=\d+.*)", "the line is well formed");
+    Assert::That(line).Should().NotMatchRegex(R"(.*ERROR.*)", "the line is not an error");
+    Assert::That(line).Should().ContainMatch(R"(id=\d+)", "the line has an id");
+    Assert::That(line).Should().ContainMatch(R"((INFO|WARN) request)", "patterns with groups work too");
+    Assert::That(std::wstring(L"hello world")).Should().MatchRegex(L"h.*o w\\w+", "wide strings can be matched");
+    for (int i = 0; i < 1000; ++i)
+    {
+        Assert::That("worker " + std::to_string(i)).Should().MatchRegex(R"(worker \d{1,3})", "the pattern is compiled once");
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_String_MatchRegex_Reports)
+{
+    const std::string line = "2023-06-14 12:00:03 INFO request id=42 done";
+    AssertionScope scope;
+    Assert::That(line).Should().MatchRegex(R"(\d+ ERROR .*)", "the line is an error");
+    Assert::That(line).Should().NotMatchRegex(R"(.*INFO.*)", "the line is not informational");
+    Assert::That(line).Should().ContainMatch(R"(user=\w+)", "the line has a user");
+    Assert::That(line).Should().MatchRegex("request (id", "the pattern is not valid");
+    const int failures = static_cast<int>(scope.FailureCount());
+    const std::string message = scope.Discard();
+    Assert::That(failures).Should().Be(4, "every assertion fails");
+    Assert::That(message).Should().Contain("done\" does not match the regular expression \"\\d+ ERROR .*\"", "the pattern is named");
+    Assert::That(message).Should().Contain("matches the regular expression \".*INFO.*\"", "the unwanted match is named");
+    Assert::That(message).Should().Contain("contains no match of the regular expression \"user=\\w+\"", "the missing match is named");
+    Assert::That(message).Should().Contain("The regular expression \"request (id\" is not valid", "the invalid pattern is named");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_String_IgnoringCase)
+{
+    const std::string log = "2023-06-14 12:00:03 INFO Request ID=42 Done";
+    Assert::That(log).Should().BeEquivalentToIgnoringCase("2023-06-14 12:00:03 info request id=42 done", "only the case differs");
+    Assert::That(log).Should().StartWithIgnoringCase("2023-06-14 12:00:03 info", "the prefix differs in case");
+    Assert::That(log).Should().ContainIgnoringCase("request id=42", "the request is logged");
+    Assert::That(std::string("\xC3\x89T\xC3\x89 \xCE\xA3")).Should().BeEquivalentToIgnoringCase("\xC3\xA9t\xC3\xA9 \xCF\x83", "UTF-8 letters are folded");
+    Assert::That(std::string("\xE2\x84\xAA" "elvin")).Should().BeEquivalentToIgnoringCase("kelvin", "the Kelvin sign folds to k");
+    Assert::That(std::wstring(L"Hello \u00C9T\u00C9")).Should().BeEquivalentToIgnoringCase(L"hello \u00E9t\u00E9", "wide strings are folded");
+    Assert::That(std::wstring(L"Hello \u00C9T\u00C9")).Should().ContainIgnoringCase(L"\u00E9t\u00E9", "wide strings can be searched");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_String_IgnoringCase_Reports)
+{
+    const std::string log = "2023-06-14 12:00:03 INFO Request ID=42 Done";
+    AssertionScope scope;
+    Assert::That(log).Should().BeEquivalentToIgnoringCase("2023-06-14 12:00:03 info request id=43 done", "the ids differ");
+    Assert::That(log).Should().StartWithIgnoringCase("2023-06-14 12:00:03 warn", "the level differs");
+    Assert::That(log).Should().ContainIgnoringCase("request id=43", "the id differs");
+    const int failures = static_cast<int>(scope.FailureCount());
+    const std::string message = scope.Discard();
+    Assert::That(failures).Should().Be(3, "every assertion fails");
+    Assert::That(message).Should().Contain("Strings differ, ignoring case, at index 37 (line 1, column 38)", "where the ids differ");
+    Assert::That(message).Should().Contain("ignoring case: it differs from index 20 (line 1, column 21)", "where the levels differ");
+    Assert::That(message).Should().Contain("does not contain \"request id=43\", ignoring case", "the missing substring is named");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_WString_Be_NonAscii)
+{
+    const std::wstring A = L"caf\u00E9 \U0001F600";
+    const std::wstring B = L"caf\u00E9 \U0001F600";
+    Assert::That(A).Should().Be(B, "wide strings outside ASCII are equal");
+    Assert::That(A).Should().NotBe(std::wstring(L"caf\u00E9 \U0001F601"), "the last character differs");
+    Assert::That(A.c_str()).Should().Be(B.c_str(), "wide C strings are equal");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_String_Match)
+{
+    const std::string log = "2023-06-14 12:00:03 INFO Request ID=42 Done";
+    Assert::That(log).Should().MatchWildcard("2023-06-14 ??:??:?? INFO *ID=4? Done", "the line has the expected shape");
+    Assert::That(log).Should().MatchWildcard("*Request*", "a pattern can be a substring");
+    Assert::That(log).Should().NotMatchWildcard("* ERROR *", "the line is not an error");
+    Assert::That(log).Should().MatchWildcardIgnoringCase("*request id=42*", "the case of a pattern can differ");
+    Assert::That(std::string("caf\xC3\xA9")).Should().MatchWildcard("caf?", "a ? matches a whole UTF-8 character");
+    Assert::That(std::wstring(L"caf\u00C9")).Should().MatchWildcardIgnoringCase(L"C*\u00E9", "wide strings are matched");
+    Assert::That(std::string(100000, 'a')).Should().NotMatchWildcard("*a*a*a*a*a*a*a*a*b", "many stars do not backtrack");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_String_Match_Reports)
+{
+    const std::string log = "2023-06-14 12:00:03 INFO Request ID=42 Done";
+    AssertionScope scope;
+    Assert::That(log).Should().MatchWildcard("2023-06-15*", "the date differs");
+    Assert::That(log).Should().MatchWildcard("2023-06-14 * WARN *", "the level differs");
+    Assert::That(log).Should().NotMatchWildcard("*Done", "the line ends with Done");
+    Assert::That(log).Should().MatchWildcardIgnoringCase("*id=43*", "the id differs");
+    const int failures = static_cast<int>(scope.FailureCount());
+    const std::string message = scope.Discard();
+    Assert::That(failures).Should().Be(4, "every assertion fails");
+    Assert::That(message).Should().Contain("does not match the wildcard pattern \"2023-06-15*\": no match gets past index 9 (line 1, column 10)", "where the dates differ");
+    Assert::That(message).Should().Contain("\"2023-06-14 * WARN *\": the string ends before the pattern does", "the level is never found");
+    Assert::That(message).Should().Contain("matches the wildcard pattern \"*Done\"", "the matching pattern is named");
+    Assert::That(message).Should().Contain("\"*id=43*\", ignoring case", "the case is ignored");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_String_Match_Names_Do_Not_Clash)
+{
+    struct Rule
+    {
+        int id;
+        bool Match(const int value) const { return value == id; }
+        bool NotMatch(const int value) const { return value != id; }
+    };
+    const Rule rule{ 42 };
+    Assert::That(rule.Match(42)).Should().BeTrue("a member called Match still compiles");
+    Assert::That(rule.NotMatch(42)).Should().BeFalse("a member called NotMatch still compiles");
+}
+
 BOOST_AUTO_TEST_CASE(Chamois_Assert_Equal_Array)
 {
     int A[5] = { 1, 2, 3, 4, 5 };
@@ -151,6 +398,33 @@ BOOST_AUTO_TEST_CASE(Chamois_Assert_NotEqual_Array)
     Assert::ThatArray(A).Should().NotBe(B, "arrays should be not equal");
 }
 
+BOOST_AUTO_TEST_CASE(Chamois_Assert_Equal_Array_Large)
+{
+    int A[1000] = {};
+    int B[1000] = {};
+    A[999] = B[999] = 7;
+    Assert::ThatArray(A).Should().Be(B, "large arrays are equal");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_NotEqual_Array_Differs_In_Last_Element)
+{
+    std::uint8_t A[100] = {};
+    std::uint8_t B[100] = {};
+    B[99] = 1;
+    Assert::ThatArray(A).Should().NotBe(B, "arrays differ in their last element");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_Equal_Array_Mismatches_Reported_Once)
+{
+    int A[6] = { 1, 2, 3, 4, 5, 6 };
+    int B[6] = { 2, 3, 3, 5, 6, 7 };
+    AssertionScope scope;
+    Assert::ThatArray(A).Should().Be(B, "all but one element is off by one");
+    const int failures = static_cast<int>(scope.FailureCount());
+    (void)scope.Discard();
+    Assert::That(failures).Should().Be(1, "the five mismatches are summarised in one failure");
+}
+
 /*
 Container tests
 */
@@ -170,6 +444,296 @@ BOOST_AUTO_TEST_CASE(Chamois_Assert_Container_Vector_NotEqual)
     Assert::ThatContainer(A).Should().NotBe(B, "vectors should be not equal.");
 }
 
+BOOST_AUTO_TEST_CASE(Chamois_Assert_Container_Vector_NotEqual_Large)
+{
+    const std::vector<std::uint8_t> A(4096, 1);
+    std::vector<std::uint8_t> B(4096, 1);
+    B[4000] = 2;
+    Assert::ThatContainer(A).Should().NotBe(B, "vectors differ near the end.");
+    AssertionScope scope;
+    Assert::ThatContainer(A).Should().Be(B, "the mismatch is found after the equal prefix");
+    Assert::That(static_cast<int>(scope.FailureCount())).Should().Be(1, "one element differs");
+    (void)scope.Discard();
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_Container_Vector_Mismatches_Reported_Once)
+{
+    const std::vector<int> A = { 1, 2, 3, 4, 5, 6 };
+    const std::vector<int> B = { 2, 3, 3, 5, 6, 7 };
+    AssertionScope scope;
+    Assert::ThatContainer(A).Should().Be(B, "all but one element is off by one");
+    const int failures = static_cast<int>(scope.FailureCount());
+    (void)scope.Discard();
+    Assert::That(failures).Should().Be(1, "the five mismatches are summarised in one failure");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_Range_Span_Equal)
+{
+    const std::vector<int> A = { 1, 2, 3, 4, 5 };
+    const int B[5] = { 1, 2, 3, 4, 5 };
+    Assert::ThatRange(std::span<const int>(A)).Should().Be(B, "a span is compared without a copy");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_Range_StringView_Equal)
+{
+    Assert::ThatRange(std::string_view("hello")).Should().Be(std::string("hello"), "string views are ranges");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_Range_Pipeline_Equal)
+{
+    const std::vector<int> A = { 1, 2, 3, 4, 5, 6 };
+    Assert::ThatRange(A | std::views::filter([](const int i) { return i % 2 == 0; }) | std::views::transform([](const int i) { return i * 10; }))
+        .Should().Be({ 20, 40, 60 }, "the pipeline is evaluated lazily, in one pass");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_Range_NotEqual)
+{
+    const std::vector<int> A = { 1, 2, 3 };
+    Assert::ThatRange(A | std::views::take(2)).Should().NotBe({ 1, 3 }, "ranges differ");
+    Assert::ThatRange(A).Should().NotBe({ 1, 2 }, "ranges differ in length");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_Range_Length_And_Empty)
+{
+    const std::vector<int> A = { 1, 2, 3, 4, 5, 6 };
+    Assert::ThatRange(A | std::views::filter([](const int i) { return i > 3; })).Should().HaveLength(3, "three are greater than 3");
+    Assert::ThatRange(A | std::views::filter([](const int i) { return i > 6; })).Should().BeEmpty("none are greater than 6");
+    Assert::ThatRange(A).Should().NotBeEmpty("the vector has elements");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_Range_Stored_Should_Twice)
+{
+    auto that = Assert::ThatRange(std::vector<int>{ 1, 2, 3 });
+    that.Should().HaveLength(3, "the stored range has 3 elements");
+    that.Should().NotBeEmpty("a second Should() still sees them");
+    that.Should().Be({ 1, 2, 3 }, "and in order");
+    Assert::ThatRange(std::vector<int>{ 4, 5 }).Should().Be({ 4, 5 }, "a temporary subject hands its range on");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_Container_Vector_Equivalent)
+{
+    const std::vector<std::string> A = { "pear", "apple", "fig", "apple" };
+    const std::vector<std::string> B = { "apple", "fig", "apple", "pear" };
+    Assert::ThatContainer(A).Should().BeEquivalentTo(B, "the same fruit in another order");
+    Assert::ThatContainer(A).Should().NotBeEquivalentTo({ "apple", "fig", "pear" }, "one apple fewer");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_Container_Map_Equivalent_Without_Hash)
+{
+    std::map<int, std::string> A = { { 1, "one" }, { 2, "two" } };
+    std::map<int, std::string> B = { { 2, "two" }, { 1, "one" } };
+    Assert::ThatContainer(A).Should().BeEquivalentTo(B, "pairs have no std::hash, so they are sorted");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_Range_Equivalent)
+{
+    const std::vector<int> A = { 3, 1, 2, 3 };
+    Assert::ThatRange(A | std::views::transform([](const int i) { return i * 10; })).Should().BeEquivalentTo({ 30, 30, 20, 10 }, "order does not matter");
+    Assert::ThatRange(A).Should().NotBeEquivalentTo({ 1, 2, 3 }, "3 is there twice");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_Container_Equivalence_Reported_Once)
+{
+    const std::vector<int> A = { 1, 2, 2, 3, 5 };
+    const std::vector<int> B = { 5, 4, 3, 2, 1 };
+    AssertionScope scope;
+    Assert::ThatContainer(A).Should().BeEquivalentTo(B, "4 is missing and there is a second 2");
+    const int failures = static_cast<int>(scope.FailureCount());
+    (void)scope.Discard();
+    Assert::That(failures).Should().Be(1, "the missing and surplus elements are summarised in one failure");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_Container_Contain)
+{
+    const std::vector<int> A = { 5, 3, 9, 1, 7, 2, 8, 6, 4, 10, 12, 11 };
+    Assert::ThatContainer(A).Should().Contain(11, "11 is near the end");
+    Assert::ThatContainer(A).Should().NotContain(13, "13 is not there");
+    const std::list<std::string> B = { "pear", "apple", "fig" };
+    Assert::ThatContainer(B).Should().Contain("fig", "fig is the last");
+    std::map<int, std::string> C = { { 1, "one" }, { 2, "two" } };
+    Assert::ThatContainer(C).Should().Contain({ 2, "two" }, "maps are looked up by key");
+    Assert::ThatContainer(C).Should().NotContain({ 2, "three" }, "the value differs");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_Container_ContainAll)
+{
+    std::vector<int> A(1000);
+    for (int i = 0; i < 1000; ++i)
+    {
+        A[static_cast<size_t>(i)] = (i * 7) % 1000;
+    }
+    Assert::ThatContainer(A).Should().ContainAll({ 0, 1, 2, 997, 998, 999 }, "a few needles are scanned for");
+    const std::vector<int> needles = { 10, 20, 30, 40, 50, 60, 70, 80, 90, 100, 110, 120 };
+    Assert::ThatContainer(A).Should().ContainAll(needles, "many needles are looked up in a hash table");
+    std::sort(A.begin(), A.end());
+    Assert::ThatContainer(A).Should().ContainAll(needles, "sorted elements are binary searched");
+    const std::list<int> L(A.begin(), A.end());
+    Assert::ThatContainer(L).Should().ContainAll(needles, "sorted lists are looked up in a hash table");
+    const std::set<std::string> B = { "apple", "fig", "pear" };
+    Assert::ThatContainer(B).Should().ContainAll({ "pear", "apple" }, "sets are looked up");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_Container_ContainAny)
+{
+    const std::vector<std::string> A = { "pear", "apple", "fig" };
+    Assert::ThatContainer(A).Should().ContainAny({ "kiwi", "fig" }, "there is a fig");
+    const std::unordered_set<int> B = { 1, 2, 3 };
+    Assert::ThatContainer(B).Should().ContainAny({ 5, 4, 3 }, "there is a 3");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_Container_ContainAll_Reports_Missing)
+{
+    const std::vector<int> A = { 1, 2, 3 };
+    AssertionScope scope;
+    Assert::ThatContainer(A).Should().ContainAll({ 1, 4, 2, 5 }, "4 and 5 are missing");
+    Assert::ThatContainer(A).Should().ContainAny({ 7, 8 }, "neither is there");
+    const int failures = static_cast<int>(scope.FailureCount());
+    (void)scope.Discard();
+    Assert::That(failures).Should().Be(2, "each assertion reports once");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_Container_BeInAscendingOrder)
+{
+    const std::vector<int> A = { 1, 2, 2, 5, 8 };
+    Assert::ThatContainer(A).Should().BeInAscendingOrder("equal neighbours are in order");
+    const std::vector<std::string> B = { "fig", "pear", "apple" };
+    Assert::ThatContainer(B).Should().BeInAscendingOrder(std::ranges::less{}, [](const std::string& word) { return word.size(); }, "by length");
+    const std::vector<std::string> C = { "apple", "pear", "fig" };
+    Assert::ThatContainer(C).Should().BeInDescendingOrder(std::ranges::less{}, [](const std::string& word) { return word.size(); }, "by length");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_Container_BeInDescendingOrder)
+{
+    const std::list<int> A = { 9, 7, 7, 3 };
+    Assert::ThatContainer(A).Should().BeInDescendingOrder("lists are checked in one pass");
+    const std::vector<std::string> B = { "pear", "apple", "Fig" };
+    Assert::ThatContainer(B).Should().BeInDescendingOrder(std::less<std::string>(), "upper case sorts first, so comes last");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_Container_BeInAscendingOrder_Large)
+{
+    std::vector<int> A(1 << 20);
+    for (size_t i = 0; i < A.size(); ++i)
+    {
+        A[i] = static_cast<int>(i / 3);
+    }
+    Assert::ThatContainer(A).Should().BeInAscendingOrder("checked in parallel chunks");
+    AssertionScope scope;
+    A[A.size() / 2] = 0;
+    Assert::ThatContainer(A).Should().BeInAscendingOrder("one element is out of place");
+    const int failures = static_cast<int>(scope.FailureCount());
+    (void)scope.Discard();
+    Assert::That(failures).Should().Be(1, "the first out of order pair is reported");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_Container_Diff_Reports_Insertion)
+{
+    const std::vector<int> A = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+    const std::vector<int> B = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+    AssertionScope scope;
+    Assert::ThatContainer(A).Should().Be(B, "0 is inserted at the front");
+    const int failures = static_cast<int>(scope.FailureCount());
+    const std::string message = scope.Discard();
+    Assert::That(failures).Should().Be(1, "the lengths and the diff are one failure");
+    Assert::That(message.find("1 removed") == std::string::npos).Should().Be(true, "nothing is removed");
+    Assert::That(message.find("@@ -0,2 +0,3 @@") != std::string::npos).Should().Be(true, "one hunk at the front");
+    Assert::That(message.find("+ 0") != std::string::npos).Should().Be(true, "the inserted element is shown");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_Range_Diff_Reports_Shift)
+{
+    const std::vector<int> A = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    const std::vector<int> B = { 9, 1, 2, 3, 4, 5, 6, 7 };
+    AssertionScope scope;
+    Assert::ThatRange(A | std::views::filter([](const int value) { return value > 0; })).Should().Be(B, "shifted by one");
+    Assert::ThatRange(std::span<const int>(A)).Should().Be(B, "shifted by one");
+    const int failures = static_cast<int>(scope.FailureCount());
+    const std::string message = scope.Discard();
+    Assert::That(failures).Should().Be(2, "each assertion reports once");
+    Assert::That(message.find("1 removed, 1 added") != std::string::npos).Should().Be(true, "a shift is two edits, not eight mismatches");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_Range_Stream_Equal)
+{
+    std::istringstream numbers("1 2 3 4");
+    Assert::ThatRange(std::istream_iterator<int>(numbers), std::istream_iterator<int>()).Should().Be({ 1, 2, 3, 4 }, "read one at a time");
+    std::istringstream words("fig pear apple");
+    const std::vector<std::string> expected = { "fig", "pear", "apple" };
+    Assert::ThatRange(std::views::istream<std::string>(words)).Should().Be(expected, "read one at a time");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_Range_Stream_Reports_First_Difference)
+{
+    AssertionScope scope;
+    std::istringstream shorter("1 2 3");
+    Assert::ThatRange(std::views::istream<int>(shorter)).Should().Be({ 1, 2, 3, 4 }, "4 is missing");
+    std::istringstream longer("1 2 3 4 5");
+    Assert::ThatRange(std::views::istream<int>(longer)).Should().Be({ 1, 2, 3, 4 }, "5 is surplus");
+    std::istringstream differs("1 2 7 4");
+    Assert::ThatRange(std::views::istream<int>(differs)).Should().Be({ 1, 2, 3, 4 }, "7 is not 3");
+    const int failures = static_cast<int>(scope.FailureCount());
+    const std::string message = scope.Discard();
+    Assert::That(failures).Should().Be(3, "each assertion reports once");
+    Assert::That(message.find("it ends at index 3, where 4 is expected") != std::string::npos).Should().Be(true, "the shorter stream");
+    Assert::That(message.find("found 5 at index 4") != std::string::npos).Should().Be(true, "the longer stream");
+    Assert::That(message.find("differs from index 2: expected 3, found 7") != std::string::npos).Should().Be(true, "the first difference");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_File_Same_Content)
+{
+    const auto write = [](const std::filesystem::path& path, const std::string& content) {
+        std::ofstream(path, std::ios::binary) << content;
+        return path;
+    };
+    std::string content(200000, '\0');
+    for (size_t i = 0; i < content.size(); ++i)
+    {
+        content[i] = static_cast<char>(i * 7);
+    }
+    const auto output = write(std::filesystem::temp_directory_path() / "chamois_same_output.bin", content);
+    const auto reference = write(std::filesystem::temp_directory_path() / "chamois_same_reference.bin", content);
+    const auto empty = write(std::filesystem::temp_directory_path() / "chamois_same_empty.bin", "");
+    Assert::ThatFile(output).Should().HaveSameContentAs(reference, "written from the same bytes");
+    Assert::ThatFile(output).Should().HaveSize(200000, "one byte for each");
+    Assert::ThatFile(output).Should().StartWith(std::string_view("\0\7\16\25", 4), "the first bytes");
+    Assert::ThatFile(empty).Should().HaveSameContentAs(empty, "empty files are the same");
+    Assert::ThatFile(empty).Should().StartWith("", "every file starts with nothing");
+    std::filesystem::remove(output);
+    std::filesystem::remove(reference);
+    std::filesystem::remove(empty);
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_File_Reports_First_Difference)
+{
+    const auto write = [](const std::filesystem::path& path, const std::string& content) {
+        std::ofstream(path, std::ios::binary) << content;
+        return path;
+    };
+    std::string content(100000, 'a');
+    const auto reference = write(std::filesystem::temp_directory_path() / "chamois_differ_reference.bin", content);
+    content[70000] = 'b';
+    const auto output = write(std::filesystem::temp_directory_path() / "chamois_differ_output.bin", content);
+    const auto shorter = write(std::filesystem::temp_directory_path() / "chamois_differ_shorter.bin", content.substr(0, 10));
+    AssertionScope scope;
+    Assert::ThatFile(output).Should().HaveSameContentAs(reference, "one byte is changed");
+    Assert::ThatFile(shorter).Should().HaveSameContentAs(reference, "it is cut short");
+    Assert::ThatFile(shorter).Should().HaveSize(100000, "it is cut short");
+    Assert::ThatFile(shorter).Should().StartWith("aaaaaaaaaaaa", "it is cut short");
+    Assert::ThatFile(std::filesystem::temp_directory_path() / "chamois_differ_missing.bin").Should().HaveSameContentAs(reference, "there is no such file");
+    const int failures = static_cast<int>(scope.FailureCount());
+    const std::string message = scope.Discard();
+    Assert::That(failures).Should().Be(5, "each assertion reports once");
+    Assert::That(message.find("Files differ from byte 70000") != std::string::npos).Should().Be(true, "the first difference");
+    Assert::That(message.find("^^") != std::string::npos).Should().Be(true, "the byte is marked");
+    Assert::That(message.find("and the first 10 are the same") != std::string::npos).Should().Be(true, "the sizes");
+    Assert::That(message.find("but it is 10") != std::string::npos).Should().Be(true, "the size");
+    Assert::That(message.find("but it is only 10 bytes") != std::string::npos).Should().Be(true, "the prefix");
+    Assert::That(message.find("Could not open") != std::string::npos).Should().Be(true, "the missing file");
+    std::filesystem::remove(output);
+    std::filesystem::remove(reference);
+    std::filesystem::remove(shorter);
+}
+
 BOOST_AUTO_TEST_CASE(Chamois_Assert_Container_Vector_Empty)
 {
     std::vector<int> A = {};
@@ -228,6 +792,143 @@ BOOST_AUTO_TEST_CASE(Chamois_Assert_Container_Map_NotEmpty)
     Assert::ThatContainer(A).Should().NotBeEmpty("map should be not empty.");
 }
 
+BOOST_AUTO_TEST_CASE(Chamois_Assert_Static_Numeric)
+{
+    static_assert(Assert::Static::That(10).Should().Be(10, "10 is equal to 10"));
+    static_assert(Assert::Static::That(10).Should().BeInRange(5, 20, "10 is between 5 and 20"));
+    static_assert(Assert::Static::That(2.4).Should().BeApproximately(2.5, 0.2, "2.4 is close to 2.5"));
+    static_assert(Assert::Static::That(true).Should().BeTrue("true is true"));
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_Static_String)
+{
+    static_assert(Assert::Static::That("hello").Should().HaveLength(5, "hello has a length of 5"));
+    static_assert(Assert::Static::That(L"hello").Should().StartWith(L"he", "hello starts with he"));
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_Static_Array)
+{
+    static constexpr int A[5] = { 1, 2, 3, 4, 5 };
+    static constexpr int B[5] = { 1, 2, 3, 4, 5 };
+    static_assert(Assert::Static::ThatArray(A).Should().Be(B, "arrays are equal"));
+    static_assert(Assert::Static::ThatArray(A).Should().HaveLength(5, "array has a length of 5"));
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_Static_Runtime_Failure_Is_False)
+{
+    const bool result = Assert::Static::That(10).Should().Be(11, "10 is not equal to 11");
+    Assert::That(result).Should().BeFalse("a failing static verb evaluated at runtime returns false");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_Lambda_Throw)
+{
+    Assert::ThatLambda([] { throw std::runtime_error("thrown"); }).Should().Throw(std::runtime_error, "the lambda throws");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_Lambda_NotThrow)
+{
+    Assert::ThatLambda([] {}).Should().NotThrow(std::runtime_error, "the lambda does not throw");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_Assert_BeApproximately_double)
+{
+    Assert::That(2.4).Should().BeApproximately(2.5, 0.2, "2.4 is within 0.2 of 2.5");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_AssertionScope_Passing)
+{
+    AssertionScope scope;
+    Assert::That(10).Should().Be(10, "10 is equal to 10");
+    Assert::That("hello").Should().StartWith("he", "string should start with he");
+    Assert::That(static_cast<int>(scope.FailureCount())).Should().Be(0, "nothing failed in the scope");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_AssertionScope_Collects_Failures)
+{
+    AssertionScope scope;
+    Assert::That(10).Should().Be(11, "first failure");
+    Assert::That(true).Should().BeFalse("second failure");
+    const int failures = static_cast<int>(scope.FailureCount());
+    const std::string report = scope.Discard();
+    Assert::That(failures).Should().Be(2, "both failures are collected");
+    Assert::That(report).Should().StartWith("2 assertion failures in scope:", "the failures are reported together");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_AssertionScope_Collects_Again_After_Discard)
+{
+    AssertionScope scope(1000);
+    for (int i = 0; i < 100; ++i)
+    {
+        Assert::That(i).Should().Be(i + 1, "fills the scope past its inline buffer");
+    }
+    (void)scope.Discard();
+    Assert::That(1).Should().Be(2, "collected after the arena is released");
+    const int failures = static_cast<int>(scope.FailureCount());
+    const std::string report = scope.Discard();
+    Assert::That(failures).Should().Be(1, "only the failure after the discard is left");
+    Assert::That(report).Should().Contain("collected after the arena is released", "the failure is intact");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_AssertionScope_Nested_Stops_Early)
+{
+    AssertionScope outer;
+    {
+        AssertionScope inner(2);
+        Assert::That(1).Should().Be(2, "collected by the inner scope");
+        Assert::That(3).Should().Be(4, "reaches the inner limit, so the inner scope reports to the outer one");
+        Assert::That(5).Should().Be(6, "the inner scope has stopped, so the outer one collects this");
+    }
+    const int failures = static_cast<int>(outer.FailureCount());
+    const std::string report = outer.Discard();
+    Assert::That(failures).Should().Be(2, "the inner scope's report and the failure after it");
+    Assert::That(report).Should().StartWith("2 assertion failures in scope:", "the outer scope reports both");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_AssertionScope_Reports_Floating_Point_In_Full)
+{
+    // Boost passes values within 0.0001% of each other, so these differ by a little more than that
+    AssertionScope scope;
+    Assert::That(0.3000004).Should().Be(0.3, "the doubles differ after the 6th digit");
+    Assert::That(1.000002f).Should().Be(1.0f, "the floats differ after the 6th digit");
+    const int failures = static_cast<int>(scope.FailureCount());
+    const std::string message = scope.Discard();
+    Assert::That(failures).Should().Be(2, "both assertions fail");
+    Assert::That(message).Should().Contain("0.3000004", "the double is shown in full");
+    Assert::That(message).Should().Contain("1.000002", "the float is shown in full");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_AssertionScope_Floating_Point_Tolerance)
+{
+    Assert::That(0.1 + 0.2).Should().Be(0.3, "Boost compares doubles to within a tolerance");
+    AssertionScope scope;
+    Assert::That(0.1 + 0.2).Should().Be(0.3, "a scope compares doubles as Boost does");
+    Assert::That(1.0000001f).Should().Be(1.0f, "a scope compares floats as Boost does");
+    Assert::That(scope.FailureCount()).Should().Be(size_t{ 0 }, "the scope passes what Boost passes");
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_ThreadAssertionScope_Passing_Worker)
+{
+    ThreadAssertionScope threads;
+    std::thread worker([] { Assert::That(10).Should().Be(10, "10 is equal to 10 on a worker"); });
+    worker.join();
+    threads.Join();
+}
+
+BOOST_AUTO_TEST_CASE(Chamois_ThreadAssertionScope_Marshals_Worker_Failures)
+{
+    AssertionScope scope;
+    {
+        ThreadAssertionScope threads;
+        std::thread worker([] { Assert::That(10).Should().Be(11, "fails on a worker"); });
+        worker.join();
+        threads.Join();
+    }
+    const int failures = static_cast<int>(scope.FailureCount());
+    const std::string report = scope.Discard();
+    Assert::That(failures).Should().Be(1, "the worker's failure is reported on the test thread");
+    Assert::That(report).Should().StartWith("1 assertion failure in scope:", "it is reported as one failure");
+}
+
 //#ifdef CHAMOIS_TEST_ENABLE_FAILING_TESTS
 BOOST_AUTO_TEST_CASE(DemonstratingFailure_Chamois_Assert_NotEqual_Strings)
 {
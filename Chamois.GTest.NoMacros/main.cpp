@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+#define GTEST_INCLUDE_GTEST_GTEST_H_
+#define CHAMOIS_NO_MACROS
+#include "Chamois.hpp"
+
+#include <stdexcept>
+#include <vector>
+
+using namespace evolutional;
+
+// The same assertions as Chamois.GTest/main.cpp, without the fluent verb macros; the call site comes from std::source_location
+
+TEST(ChamoisNoMacrosTest, Chamois_Assert_Equal_int_10)
+{
+    Assert::That(10).Should().Be(10, "10 is equal to 10");
+}
+
+TEST(ChamoisNoMacrosTest, Chamois_Assert_10_BeInRange_int_5_20)
+{
+    Assert::That(10).Should().BeInRange(5, 20, "10 between 5 and 20");
+}
+
+TEST(ChamoisNoMacrosTest, Chamois_Assert_BeZero_int)
+{
+    Assert::That(0).Should().BeZero("0 is zero");
+}
+
+TEST(ChamoisNoMacrosTest, Chamois_Assert_True_bool)
+{
+    Assert::That(true).Should().BeTrue("true is true");
+}
+
+TEST(ChamoisNoMacrosTest, Chamois_Assert_String_StartsWith)
+{
+    Assert::That("hello").Should().StartWith("hel", "string starts with hel");
+}
+
+TEST(ChamoisNoMacrosTest, Chamois_Assert_Equal_Array)
+{
+    int A[5] = { 1, 2, 3, 4, 5 };
+    int B[5] = { 1, 2, 3, 4, 5 };
+    Assert::ThatArray(A).Should().Be(B, "arrays are equal");
+}
+
+TEST(ChamoisNoMacrosTest, Chamois_Assert_Container_Vector_Equal)
+{
+    std::vector<int> A = { 1, 2, 3, 4, 5 };
+    std::vector<int> B = { 1, 2, 3, 4, 5 };
+    Assert::ThatContainer(A).Should().Be(B, "vectors are equal.");
+}
+
+TEST(ChamoisNoMacrosTest, Chamois_Assert_Range_Pipeline)
+{
+    const std::vector<int> A = { 1, 2, 3, 4, 5, 6 };
+    Assert::ThatRange(A | std::views::filter([](const int i) { return i % 2 == 0; })).Should().Be({ 2, 4, 6 }, "the even numbers");
+    Assert::ThatRange(std::views::empty<int>).Should().BeEmpty();
+}
+
+TEST(ChamoisNoMacrosTest, Use_Shared_Ptr)
+{
+    const auto strPtr = std::make_unique<std::string>("Test String");
+    Assert::ThatPtr(strPtr).Should().NotBeNull("Problem Checking nullable string");
+}
+
+TEST(ChamoisNoMacrosTest, Chamois_Assert_Static_Numeric)
+{
+    static_assert(Assert::Static::That(10).Should().BeInRange(5, 20));
+    static_assert(Assert::Static::That("hello").Should().StartWith("he"));
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
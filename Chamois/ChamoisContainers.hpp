@@ -0,0 +1,704 @@
+#pragma once
+
+/*
+ *    Copyright 2014 Oli Wilkinson
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *        distributed under the License is distributed on an "AS IS" BASIS,
+ *        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *        See the License for the specific language governing permissions and
+ *        limitations under the License.
+ *
+ *    Then modified by Smurf-IV from 2022-12-12 onwards
+ *    https://github.com/Smurf-IV/FluentAssertions-for-Cpp/commits/master
+ *    Current date is 2023-06-14
+ */
+
+// Opt-in `Assert::ThatContainer` support; also included by Chamois.hpp.
+
+#include <algorithm>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <ranges>
+#include <sstream>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "ChamoisCore.hpp"
+#include "ChamoisDiff.hpp"
+#include "ChamoisEquivalence.hpp"
+
+#ifndef CHAMOIS_PARALLEL_ORDER_THRESHOLD
+/// From how many elements a random access container's order is checked on every core
+#define CHAMOIS_PARALLEL_ORDER_THRESHOLD (1u << 18)
+#endif
+
+namespace evolutional
+{
+namespace detail
+{
+// teach std::ostringstream how to print std::vector
+template <typename T>
+inline std::basic_ostream<char, std::char_traits<char>>& operator<<(std::basic_ostream<char, std::char_traits<char>>& wrapped, const std::vector<T>& item)
+{
+    wrapped << '[';
+    bool first = true;
+    for (auto const& element : item) {
+        wrapped << (!first ? "," : "") << element;
+        first = false;
+    }
+    return wrapped << ']';
+}
+// teach std::ostringstream how to print std::pair
+template <typename K, typename V>
+std::basic_ostream<char, std::char_traits<char>>& operator<<(std::basic_ostream<char, std::char_traits<char>>& wrapped, const std::pair<const K, V>& item)
+{
+    return wrapped << '<' << item.first << ',' << item.second << '>';
+}
+
+// Sets and maps, ordered or not: looked up by key rather than searched
+template <typename Container>
+concept AssociativeContainer = requires(const Container& container, const typename Container::key_type& key) {
+    container.equal_range(key);
+};
+
+template <class TAssertImpl, typename Container> class ShouldContainerImpl
+{
+public:
+    typedef typename Container::value_type m_valuetype;
+    using iterator = typename Container::iterator;
+    using const_iterator = typename Container::const_iterator;
+
+    explicit ShouldContainerImpl(const Container& c)
+        : container_(c)
+    {
+    }
+
+    void _beFunc(const char* file, const int line, const Container& other, const std::string_view because = {})
+    {
+        const size_t common = container_.size() < other.size() ? container_.size() : other.size();
+        size_t first = 0;
+        auto actual = container_.begin();
+        auto expected = other.begin();
+        if constexpr (std::contiguous_iterator<const_iterator>)
+        {
+            // Skip the equal prefix of vectors, strings and the like a block of memory at a time
+            first = FirstMismatch(std::data(container_), std::data(other), common);
+            actual += static_cast<std::ptrdiff_t>(first);
+            expected += static_cast<std::ptrdiff_t>(first);
+        }
+        for (; first != common && !(*actual != *expected); ++first, ++actual, ++expected)
+        {
+        }
+        if (first != common || container_.size() != other.size())
+        {
+            ReportDifferences(other, first, FailureContext(file, line, because));
+        }
+    }
+
+    void _notBeFunc(const char* file, const int line, const Container& other, const std::string_view because = {})
+    {
+        if (other.size() != container_.size())
+        {
+            return;
+        }
+
+        for (auto actual = container_.begin(), expected = other.begin();
+            actual != container_.end() && expected != other.end(); ++actual, ++expected)
+        {
+            if (*actual != *expected)
+            {
+                return;
+            }
+        }
+
+        TAssertImpl::AssertFail(FailureContext(file, line, because));
+    }
+
+    void _beEquivalentToFunc(const char* file, const int line, const Container& other, const std::string_view because = {})
+    {
+        if (const Equivalence<m_valuetype> equivalence(container_, other); !equivalence.Equivalent())
+        {
+            TAssertImpl::AssertFail(FailureContext(file, line, because).WithReason(equivalence.Text(Format)));
+        }
+    }
+
+    void _notBeEquivalentToFunc(const char* file, const int line, const Container& other,
+        const std::string_view because = {})
+    {
+        if (Equivalence<m_valuetype>(container_, other).Equivalent())
+        {
+            TAssertImpl::AssertFail(FailureContext(file, line, because, "Collections are equivalent"));
+        }
+    }
+
+    void _containFunc(const char* file, const int line, const m_valuetype& element, const std::string_view because = {})
+    {
+        if (!Contains(element))
+        {
+            ReportElements("Collection does not contain ", { &element }, FailureContext(file, line, because));
+        }
+    }
+
+    void _notContainFunc(const char* file, const int line, const m_valuetype& element,
+        const std::string_view because = {})
+    {
+        if (Contains(element))
+        {
+            ReportElements("Collection contains ", { &element }, FailureContext(file, line, because));
+        }
+    }
+
+    template <std::ranges::input_range TElements>
+    void _containAllFunc(const char* file, const int line, const TElements& elements, const std::string_view because = {})
+    {
+        std::deque<m_valuetype> copies;
+        const auto needles = ElementAddresses(elements, copies);
+        if (const auto absent = Absent(needles, false); !absent.empty())
+        {
+            ReportElements("Collection is missing " + std::to_string(absent.size()) + " of " +
+                std::to_string(needles.size()) + " elements: ", absent, FailureContext(file, line, because));
+        }
+    }
+
+    void _containAllFunc(const char* file, const int line, const std::initializer_list<m_valuetype> elements,
+        const std::string_view because = {})
+    {
+        _containAllFunc<std::initializer_list<m_valuetype>>(file, line, elements, because);
+    }
+
+    template <std::ranges::input_range TElements>
+    void _containAnyFunc(const char* file, const int line, const TElements& elements, const std::string_view because = {})
+    {
+        std::deque<m_valuetype> copies;
+        const auto needles = ElementAddresses(elements, copies);
+        if (const auto absent = Absent(needles, true); needles.empty() || !absent.empty())
+        {
+            ReportElements("Collection contains none of the " + std::to_string(needles.size()) + " elements: ", absent,
+                FailureContext(file, line, because));
+        }
+    }
+
+    void _containAnyFunc(const char* file, const int line, const std::initializer_list<m_valuetype> elements,
+        const std::string_view because = {})
+    {
+        _containAnyFunc<std::initializer_list<m_valuetype>>(file, line, elements, because);
+    }
+
+    void _beInAscendingOrderFunc(const char* file, const int line, const std::string_view because = {})
+    {
+        CheckOrder(std::ranges::less{}, std::identity{}, "ascending", FailureContext(file, line, because));
+    }
+
+    template <typename TCompare>
+        requires std::indirect_strict_weak_order<TCompare, const_iterator>
+    void _beInAscendingOrderFunc(const char* file, const int line, TCompare compare, const std::string_view because = {})
+    {
+        CheckOrder(std::move(compare), std::identity{}, "ascending", FailureContext(file, line, because));
+    }
+
+    template <typename TCompare, typename TProjection>
+        requires std::indirect_strict_weak_order<TCompare, std::projected<const_iterator, TProjection>>
+    void _beInAscendingOrderFunc(const char* file, const int line, TCompare compare, TProjection projection,
+        const std::string_view because = {})
+    {
+        CheckOrder(std::move(compare), std::move(projection), "ascending", FailureContext(file, line, because));
+    }
+
+    void _beInDescendingOrderFunc(const char* file, const int line, const std::string_view because = {})
+    {
+        CheckOrder(std::ranges::greater{}, std::identity{}, "descending", FailureContext(file, line, because));
+    }
+
+    template <typename TCompare>
+        requires std::indirect_strict_weak_order<TCompare, const_iterator>
+    void _beInDescendingOrderFunc(const char* file, const int line, TCompare compare,
+        const std::string_view because = {})
+    {
+        CheckOrder(Reversed(std::move(compare)), std::identity{}, "descending", FailureContext(file, line, because));
+    }
+
+    template <typename TCompare, typename TProjection>
+        requires std::indirect_strict_weak_order<TCompare, std::projected<const_iterator, TProjection>>
+    void _beInDescendingOrderFunc(const char* file, const int line, TCompare compare, TProjection projection,
+        const std::string_view because = {})
+    {
+        CheckOrder(Reversed(std::move(compare)), std::move(projection), "descending",
+            FailureContext(file, line, because));
+    }
+
+    void _haveLengthFunc(const char* file, const int line, const size_t expected_length,
+        const std::string_view because = {})
+    {
+        TAssertImpl::AssertEqual(expected_length, container_.size(), FailureContext(file, line, because));
+    }
+
+    void _notHaveLengthFunc(const char* file, const int line, const size_t expected_length,
+        const std::string_view because = {})
+    {
+        TAssertImpl::AssertNotEqual(expected_length, container_.size(),
+            FailureContext(file, line, because));
+    }
+
+    void _beEmptyFunc(const char* file, const int line, const std::string_view because = {}) const
+    {
+        TAssertImpl::AssertTrue(container_.empty(), FailureContext(file, line, because));
+    }
+
+    void _notBeEmptyFunc(const char* file, const int line, const std::string_view because = {}) const
+    {
+        TAssertImpl::AssertFalse(container_.empty(), FailureContext(file, line, because));
+    }
+
+#ifdef CHAMOIS_NO_MACROS
+    void Be(const Container& other, const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _beFunc(location.file_name(), static_cast<int>(location.line()), other, because);
+    }
+
+    void NotBe(const Container& other, const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _notBeFunc(location.file_name(), static_cast<int>(location.line()), other, because);
+    }
+
+    void BeEquivalentTo(const Container& other, const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _beEquivalentToFunc(location.file_name(), static_cast<int>(location.line()), other, because);
+    }
+
+    void NotBeEquivalentTo(const Container& other, const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _notBeEquivalentToFunc(location.file_name(), static_cast<int>(location.line()), other, because);
+    }
+
+    void Contain(const m_valuetype& element, const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _containFunc(location.file_name(), static_cast<int>(location.line()), element, because);
+    }
+
+    void NotContain(const m_valuetype& element, const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _notContainFunc(location.file_name(), static_cast<int>(location.line()), element, because);
+    }
+
+    template <std::ranges::input_range TElements>
+    void ContainAll(const TElements& elements, const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _containAllFunc(location.file_name(), static_cast<int>(location.line()), elements, because);
+    }
+
+    void ContainAll(const std::initializer_list<m_valuetype> elements, const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _containAllFunc(location.file_name(), static_cast<int>(location.line()), elements, because);
+    }
+
+    template <std::ranges::input_range TElements>
+    void ContainAny(const TElements& elements, const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _containAnyFunc(location.file_name(), static_cast<int>(location.line()), elements, because);
+    }
+
+    void ContainAny(const std::initializer_list<m_valuetype> elements, const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _containAnyFunc(location.file_name(), static_cast<int>(location.line()), elements, because);
+    }
+
+    void BeInAscendingOrder(const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _beInAscendingOrderFunc(location.file_name(), static_cast<int>(location.line()), because);
+    }
+
+    template <typename TCompare>
+        requires std::indirect_strict_weak_order<TCompare, const_iterator>
+    void BeInAscendingOrder(TCompare compare, const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _beInAscendingOrderFunc(location.file_name(), static_cast<int>(location.line()), std::move(compare), because);
+    }
+
+    template <typename TCompare, typename TProjection>
+        requires std::indirect_strict_weak_order<TCompare, std::projected<const_iterator, TProjection>>
+    void BeInAscendingOrder(TCompare compare, TProjection projection, const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _beInAscendingOrderFunc(location.file_name(), static_cast<int>(location.line()), std::move(compare),
+            std::move(projection), because);
+    }
+
+    void BeInDescendingOrder(const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _beInDescendingOrderFunc(location.file_name(), static_cast<int>(location.line()), because);
+    }
+
+    template <typename TCompare>
+        requires std::indirect_strict_weak_order<TCompare, const_iterator>
+    void BeInDescendingOrder(TCompare compare, const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _beInDescendingOrderFunc(location.file_name(), static_cast<int>(location.line()), std::move(compare), because);
+    }
+
+    template <typename TCompare, typename TProjection>
+        requires std::indirect_strict_weak_order<TCompare, std::projected<const_iterator, TProjection>>
+    void BeInDescendingOrder(TCompare compare, TProjection projection, const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _beInDescendingOrderFunc(location.file_name(), static_cast<int>(location.line()), std::move(compare),
+            std::move(projection), because);
+    }
+
+    void HaveLength(const size_t expected_length, const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _haveLengthFunc(location.file_name(), static_cast<int>(location.line()), expected_length, because);
+    }
+
+    void NotHaveLength(const size_t expected_length, const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _notHaveLengthFunc(location.file_name(), static_cast<int>(location.line()), expected_length, because);
+    }
+
+    void BeEmpty(const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        _beEmptyFunc(location.file_name(), static_cast<int>(location.line()), because);
+    }
+
+    void NotBeEmpty(const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        _notBeEmptyFunc(location.file_name(), static_cast<int>(location.line()), because);
+    }
+#endif
+
+private:
+    static std::string Format(const m_valuetype& value)
+    {
+        if constexpr (!std::is_floating_point_v<m_valuetype> && requires(std::ostream& stream) { stream << value; })
+        {
+            std::ostringstream text;
+            text << value;
+            return text.str();
+        }
+        else
+        {
+            return Describe(value);
+        }
+    }
+
+    // Up to this many elements, each is looked for with its own SIMD pass rather than all of them with a hash table
+    static constexpr size_t ScannedElementLimit = 8;
+
+    static decltype(auto) KeyOf(const m_valuetype& element)
+    {
+        if constexpr (std::is_same_v<typename Container::key_type, m_valuetype>)
+        {
+            return element;
+        }
+        else
+        {
+            return (element.first);
+        }
+    }
+
+    // By key for sets and maps, a block of memory at a time for contiguous integers, otherwise one at a time
+    bool Contains(const m_valuetype& element) const
+    {
+        if constexpr (AssociativeContainer<Container>)
+        {
+            auto [first, last] = container_.equal_range(KeyOf(element));
+            return std::find(first, last, element) != last;
+        }
+        else if constexpr (std::contiguous_iterator<typename Container::const_iterator>)
+        {
+            return FindElement(std::data(container_), container_.size(), element) != container_.size();
+        }
+        else
+        {
+            return std::find(container_.begin(), container_.end(), element) != container_.end();
+        }
+    }
+
+    // The needles that are not in the container; when `any`, none as soon as one of them is found
+    std::vector<const m_valuetype*> Absent(const std::vector<const m_valuetype*>& needles, const bool any) const
+    {
+        std::vector<const m_valuetype*> absent;
+        const auto search = [&](const auto& contains) {
+            for (const m_valuetype* needle : needles)
+            {
+                if (!contains(*needle))
+                {
+                    absent.push_back(needle);
+                }
+                else if (any)
+                {
+                    absent.clear();
+                    break;
+                }
+            }
+            return absent;
+        };
+        if constexpr (!AssociativeContainer<Container>)
+        {
+            constexpr bool scanned = std::contiguous_iterator<typename Container::const_iterator> &&
+                IsBitwiseComparable<m_valuetype>::value;
+            // Off random access, a binary search walks the container for each needle, so the hashed pass is cheaper
+            if constexpr (LessThanComparable<m_valuetype> &&
+                std::random_access_iterator<typename Container::const_iterator>)
+            {
+                // Finding out costs a single pass at worst, and usually stops within the first few elements
+                if ((!scanned || needles.size() > ScannedElementLimit) &&
+                    std::is_sorted(container_.begin(), container_.end()))
+                {
+                    return search([this](const m_valuetype& needle) {
+                        return std::binary_search(container_.begin(), container_.end(), needle);
+                    });
+                }
+            }
+            if constexpr (Hashable<m_valuetype>)
+            {
+                if (!scanned || needles.size() > ScannedElementLimit)
+                {
+                    return AbsentHashed(needles, any);
+                }
+            }
+        }
+        return search([this](const m_valuetype& needle) { return Contains(needle); });
+    }
+
+    // A single pass over the container, looking each element up among the needles
+    std::vector<const m_valuetype*> AbsentHashed(const std::vector<const m_valuetype*>& needles, const bool any) const
+    {
+        // -1 for a needle that has not been found yet, 1 once it has
+        ElementCounts<m_valuetype> wanted(needles.size());
+        size_t remaining = 0;
+        for (const m_valuetype* needle : needles)
+        {
+            if (auto& state = wanted[needle]; state == 0)
+            {
+                state = -1;
+                ++remaining;
+            }
+        }
+        for (auto element = container_.begin(); remaining > 0 && element != container_.end(); ++element)
+        {
+            if (auto* state = wanted.Find(*element); state != nullptr && *state < 0)
+            {
+                if (any)
+                {
+                    return {};
+                }
+                *state = 1;
+                --remaining;
+            }
+        }
+        std::vector<const m_valuetype*> absent;
+        for (const m_valuetype* needle : needles)
+        {
+            if (auto* state = wanted.Find(*needle); *state < 0)
+            {
+                absent.push_back(needle);
+                *state = 0;
+            }
+        }
+        return absent;
+    }
+
+    template <typename TCompare> static auto Reversed(TCompare compare)
+    {
+        return [compare = std::move(compare)](auto&& lhs, auto&& rhs) {
+            return std::invoke(compare, std::forward<decltype(rhs)>(rhs), std::forward<decltype(lhs)>(lhs));
+        };
+    }
+
+    template <typename TCompare, typename TProjection>
+    void CheckOrder(const TCompare compare, const TProjection projection, const char* order,
+        const FailureContext& context) const
+    {
+        if (const auto unordered = FirstOutOfOrder(compare, projection); unordered != container_.end())
+        {
+            ReportOutOfOrder(unordered, order, context);
+        }
+    }
+
+    // The first element that should have come before the one in front of it, or end().
+    // Large random access containers are split into a chunk per core, each of which also checks the boundary with
+    // the chunk before it; `compare` and `projection` are then called from several threads at once
+    template <typename TCompare, typename TProjection>
+    const_iterator FirstOutOfOrder(const TCompare& compare, const TProjection& projection) const
+    {
+        const const_iterator first = container_.begin();
+        if constexpr (std::random_access_iterator<const_iterator>)
+        {
+            const size_t size = container_.size();
+            const size_t chunks = std::thread::hardware_concurrency();
+            if (size >= CHAMOIS_PARALLEL_ORDER_THRESHOLD && chunks > 1)
+            {
+                const size_t chunk = (size + chunks - 1) / chunks;
+                std::vector<size_t> unordered(chunks, size);
+                std::vector<std::exception_ptr> errors(chunks);
+                const auto check = [&](const size_t index) {
+                    try
+                    {
+                        const size_t begin = index * chunk;
+                        const size_t end = begin + chunk < size ? begin + chunk : size;
+                        if (begin < end)
+                        {
+                            const auto from = first + static_cast<std::ptrdiff_t>(begin > 0 ? begin - 1 : 0);
+                            const auto to = first + static_cast<std::ptrdiff_t>(end);
+                            const auto found = std::ranges::is_sorted_until(from, to, compare, projection);
+                            unordered[index] = found != to ? static_cast<size_t>(found - first) : size;
+                        }
+                    }
+                    catch (...)
+                    {
+                        errors[index] = std::current_exception();
+                    }
+                };
+                std::vector<std::thread> workers;
+                workers.reserve(chunks - 1);
+                size_t started = 1;
+                try
+                {
+                    for (; started < chunks; ++started)
+                    {
+                        workers.emplace_back(check, started);
+                    }
+                }
+                catch (const std::system_error&)
+                {
+                    // Out of threads: the chunks that have none are checked on this one, and the workers that did
+                    // start are still joined below
+                }
+                check(0);
+                for (size_t index = started; index < chunks; ++index)
+                {
+                    check(index);
+                }
+                for (std::thread& worker : workers)
+                {
+                    worker.join();
+                }
+                for (size_t index = 0; index < chunks; ++index)
+                {
+                    if (errors[index])
+                    {
+                        std::rethrow_exception(errors[index]);
+                    }
+                    if (unordered[index] != size)
+                    {
+                        return first + static_cast<std::ptrdiff_t>(unordered[index]);
+                    }
+                }
+                return container_.end();
+            }
+        }
+        return std::ranges::is_sorted_until(first, container_.end(), compare, projection);
+    }
+
+    CHAMOIS_COLD void ReportOutOfOrder(const const_iterator unordered, const char* order,
+        const FailureContext& context) const
+    {
+        const auto index = static_cast<size_t>(std::distance(container_.begin(), unordered));
+        std::string text = std::string("Collection is not in ") + order + " order: [" + std::to_string(index - 1) +
+            "] " + Format(*std::prev(unordered)) + " is followed by [" + std::to_string(index) + "] " +
+            Format(*unordered);
+        TAssertImpl::AssertFail(context.WithReason(text));
+    }
+
+    // The reason, followed by the elements, up to CHAMOIS_MISMATCH_INDEX_LIMIT of them
+    CHAMOIS_COLD static void ReportElements(std::string text, const std::vector<const m_valuetype*>& elements,
+        const FailureContext& context)
+    {
+        for (size_t i = 0; i < elements.size() && i < CHAMOIS_MISMATCH_INDEX_LIMIT; ++i)
+        {
+            text += (i == 0 ? "" : ", ") + Format(*elements[i]);
+        }
+        if (elements.size() > CHAMOIS_MISMATCH_INDEX_LIMIT)
+        {
+            text += ", ... (" + std::to_string(elements.size() - CHAMOIS_MISMATCH_INDEX_LIMIT) + " more)";
+        }
+        TAssertImpl::AssertFail(context.WithReason(text));
+    }
+
+    // All the mismatches, or the lengths, and the diff, as a single failure
+    // From `first`, the first difference on; the elements before it are equal, and not shown
+    CHAMOIS_COLD void ReportDifferences(const Container& other, const size_t first, const FailureContext& context) const
+    {
+        std::string reason;
+        const auto skip = static_cast<std::ptrdiff_t>(first);
+        if constexpr (std::random_access_iterator<const_iterator> &&
+            std::is_lvalue_reference_v<std::iter_reference_t<const_iterator>>)
+        {
+            reason = DescribeDifferences<m_valuetype>("Collection", other.size() - first, container_.size() - first,
+                [begin = other.begin() + skip](const size_t i) -> const m_valuetype& { return begin[static_cast<std::ptrdiff_t>(i)]; },
+                [begin = container_.begin() + skip](const size_t i) -> const m_valuetype& { return begin[static_cast<std::ptrdiff_t>(i)]; },
+                &Format, first);
+        }
+        else
+        {
+            // Elements such as the bits of a std::vector<bool> are copied
+            std::deque<m_valuetype> expected_copies;
+            std::deque<m_valuetype> actual_copies;
+            const auto expected =
+                ElementAddresses(std::ranges::subrange(std::next(other.begin(), skip), other.end()), expected_copies);
+            const auto actual = ElementAddresses(
+                std::ranges::subrange(std::next(container_.begin(), skip), container_.end()), actual_copies);
+            reason = DescribeDifferences<m_valuetype>("Collection", expected.size(), actual.size(),
+                [&expected](const size_t i) -> const m_valuetype& { return *expected[i]; },
+                [&actual](const size_t i) -> const m_valuetype& { return *actual[i]; }, &Format, first);
+        }
+        TAssertImpl::AssertFail(context.WithReason(reason));
+    }
+
+    const Container& container_;
+};
+
+template <class TAssertImpl, typename Container> class ThatContainerImpl
+{
+public:
+    explicit ThatContainerImpl(const Container& c)
+        : container_(c)
+    {
+    }
+
+    ShouldContainerImpl<TAssertImpl, Container> Should()
+    {
+        return ShouldContainerImpl<TAssertImpl, Container>(container_);
+    }
+
+private:
+    const Container& container_;
+};
+}    // namespace detail
+
+template <class TAssertImpl>
+template <typename T>
+detail::ThatContainerImpl<TAssertImpl, T> BasicAssert<TAssertImpl>::ThatContainer(const T& container)
+{
+    return detail::ThatContainerImpl<TAssertImpl, T>(container);
+}
+}    //namespace evolutional
@@ -0,0 +1,3372 @@
+#pragma once
+
+/*
+ *    Copyright 2014 Oli Wilkinson
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *        distributed under the License is distributed on an "AS IS" BASIS,
+ *        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *        See the License for the specific language governing permissions and
+ *        limitations under the License.
+ *
+ *    Then modified by Smurf-IV from 2022-12-12 onwards
+ *    https://github.com/Smurf-IV/FluentAssertions-for-Cpp/commits/master
+ *    Current date is 2023-06-14
+ */
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <initializer_list>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#ifdef CHAMOIS_NO_MACROS
+#include <source_location>
+#endif
+
+#include "ChamoisSimd.hpp"
+
+ // ReSharper disable CppClangTidyCppcoreguidelinesMacroUsage // Needed to stop trying to replace the __FILE__ usage inside the callers function
+ // ReSharper disable CppInconsistentNaming                  // Needed to look like Macros are the actual function calls inside callers function
+
+#ifdef CHAMOIS_UNITTEST_FRAMEWORK
+#undef CHAMOIS_UNITTEST_FRAMEWORK
+#endif
+
+#define CHAMOIS_UNITTEST_FRAMEWORK_MS 1
+#define CHAMOIS_UNITTEST_FRAMEWORK_GTEST 2
+#define CHAMOIS_UNITTEST_FRAMEWORK_BOOST 3
+#define CHAMOIS_UNITTEST_FRAMEWORK_CATCH2 4
+
+#ifdef MS_CPP_UNITTESTFRAMEWORK
+#ifdef CHAMOIS_UNITTEST_FRAMEWORK
+#error Multiple test frameworks found
+#endif
+#define CHAMOIS_UNITTEST_FRAMEWORK CHAMOIS_UNITTEST_FRAMEWORK_MS
+#endif
+
+#if defined(GTEST_INCLUDE_GTEST_GTEST_H_) || defined(GOOGLETEST_INCLUDE_GTEST_GTEST_H_)
+#ifdef CHAMOIS_UNITTEST_FRAMEWORK
+#error Multiple test frameworks found
+#endif
+#define CHAMOIS_UNITTEST_FRAMEWORK CHAMOIS_UNITTEST_FRAMEWORK_GTEST
+#endif
+
+#ifdef BOOST_TEST_MODULE
+#include <ostream>
+#ifdef CHAMOIS_UNITTEST_FRAMEWORK
+#error Multiple test frameworks found
+#endif
+#define CHAMOIS_UNITTEST_FRAMEWORK CHAMOIS_UNITTEST_FRAMEWORK_BOOST
+#endif
+
+#ifdef INTERNAL_CATCH_TRY
+#ifdef CHAMOIS_UNITTEST_FRAMEWORK
+#error Multiple test frameworks found
+#endif
+#define CHAMOIS_UNITTEST_FRAMEWORK CHAMOIS_UNITTEST_FRAMEWORK_CATCH2
+#endif
+
+#ifndef CHAMOIS_UNITTEST_FRAMEWORK
+#error No supported test framework found
+#endif
+
+// Keeps a failure path out of line, and out of the way of the passing path
+#if defined(__GNUC__) || defined(__clang__)
+#define CHAMOIS_COLD __attribute__((cold, noinline))
+#elif defined(_MSC_VER)
+#define CHAMOIS_COLD __declspec(noinline)
+#else
+#define CHAMOIS_COLD
+#endif
+
+namespace evolutional
+{
+namespace detail
+{
+///
+/// Everything needed to describe a failed assertion, captured without formatting or allocating.
+/// The backends only render it into text on their failure path, so a passing assertion never pays for the message.
+class FailureContext
+{
+public:
+    FailureContext(const char* file, const int line, const std::string_view because,
+        const std::string_view reason = {}) noexcept
+        : m_file(file), m_line(line), m_because(because), m_reason(reason)
+    {
+    }
+
+    [[nodiscard]] const char* file() const noexcept
+    {
+        return m_file;
+    }
+
+    [[nodiscard]] int line() const noexcept
+    {
+        return m_line;
+    }
+
+    [[nodiscard]] std::string_view because() const noexcept
+    {
+        return m_because;
+    }
+
+    [[nodiscard]] std::string_view reason() const noexcept
+    {
+        return m_reason;
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return m_reason.empty() && m_because.empty();
+    }
+
+    /// Same call site, with a failure specific reason reported ahead of the `because`
+    [[nodiscard]] FailureContext WithReason(const std::string_view reason) const noexcept
+    {
+        return FailureContext(m_file, m_line, m_because, reason);
+    }
+
+    /// The reason and the `because`, without the location
+    [[nodiscard]] std::string Message() const
+    {
+        std::string message(m_reason);
+        if (!m_reason.empty() && !m_because.empty())
+        {
+            message += '\n';
+        }
+        message += m_because;
+        return message;
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const FailureContext& context)
+    {
+        return os << context.Message();
+    }
+
+private:
+    const char* m_file;
+    int m_line;
+    std::string_view m_because;
+    std::string_view m_reason;
+};
+
+///
+/// Failure path only: text for the messages, with wide strings encoded as UTF-8
+inline std::string Narrow(const std::string_view value)
+{
+    return std::string(value);
+}
+
+inline std::string Narrow(const std::wstring_view value)
+{
+    std::string narrow;
+    narrow.reserve(value.length());
+    for (size_t i = 0; i < value.length(); ++i)
+    {
+        auto code_point = static_cast<std::uint32_t>(value[i]);
+        if constexpr (sizeof(wchar_t) == 2)
+        {
+            // UTF-16: recombine surrogate pairs
+            if (code_point >= 0xD800 && code_point <= 0xDBFF && i + 1 < value.length())
+            {
+                const auto low = static_cast<std::uint32_t>(value[i + 1]);
+                if (low >= 0xDC00 && low <= 0xDFFF)
+                {
+                    code_point = 0x10000 + ((code_point - 0xD800) << 10) + (low - 0xDC00);
+                    ++i;
+                }
+            }
+        }
+        if (code_point < 0x80)
+        {
+            narrow += static_cast<char>(code_point);
+        }
+        else if (code_point < 0x800)
+        {
+            narrow += static_cast<char>(0xC0 | (code_point >> 6));
+            narrow += static_cast<char>(0x80 | (code_point & 0x3F));
+        }
+        else if (code_point < 0x10000)
+        {
+            narrow += static_cast<char>(0xE0 | (code_point >> 12));
+            narrow += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+            narrow += static_cast<char>(0x80 | (code_point & 0x3F));
+        }
+        else
+        {
+            narrow += static_cast<char>(0xF0 | (code_point >> 18));
+            narrow += static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+            narrow += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+            narrow += static_cast<char>(0x80 | (code_point & 0x3F));
+        }
+    }
+    return narrow;
+}
+
+#if CHAMOIS_UNITTEST_FRAMEWORK == CHAMOIS_UNITTEST_FRAMEWORK_MS
+class MsAssert
+{
+    static std::wstring message(const FailureContext& context)
+    {
+        RETURN_WIDE_STRING(GetStackMessage(context).c_str());
+    }
+
+public:
+    template <typename T> static void Equal(const T& expected_value, const T& actual_value, const FailureContext& context)
+    {
+        if (!(expected_value == actual_value))
+        {
+            Microsoft::VisualStudio::CppUnitTestFramework::Assert::AreEqual(expected_value, actual_value, message(context).c_str());
+        }
+    }
+
+    template <typename T>
+    static void NotEqual(const T& expected_value, const T& actual_value, const FailureContext& context)
+    {
+        if (!(expected_value != actual_value))
+        {
+            Microsoft::VisualStudio::CppUnitTestFramework::Assert::AreNotEqual(expected_value, actual_value, message(context).c_str());
+        }
+    }
+
+    // The framework only knows how to print owning strings, so those are only made once the views differ
+    template <typename CharT>
+    static void Equal(const std::basic_string_view<CharT> expected_value, const std::basic_string_view<CharT> actual_value,
+        const FailureContext& context)
+    {
+        if (expected_value != actual_value)
+        {
+            Microsoft::VisualStudio::CppUnitTestFramework::Assert::AreEqual(std::basic_string<CharT>(expected_value),
+                std::basic_string<CharT>(actual_value), message(context).c_str());
+        }
+    }
+
+    template <typename CharT>
+    static void NotEqual(const std::basic_string_view<CharT> expected_value, const std::basic_string_view<CharT> actual_value,
+        const FailureContext& context)
+    {
+        if (expected_value == actual_value)
+        {
+            Microsoft::VisualStudio::CppUnitTestFramework::Assert::AreNotEqual(std::basic_string<CharT>(expected_value),
+                std::basic_string<CharT>(actual_value), message(context).c_str());
+        }
+    }
+
+    static void True(const bool& actual_value, const FailureContext& context)
+    {
+        if (!actual_value)
+        {
+            Microsoft::VisualStudio::CppUnitTestFramework::Assert::IsTrue(actual_value, message(context).c_str());
+        }
+    }
+
+    static void False(const bool& actual_value, const FailureContext& context)
+    {
+        if (actual_value)
+        {
+            Microsoft::VisualStudio::CppUnitTestFramework::Assert::IsFalse(actual_value, message(context).c_str());
+        }
+    }
+
+    static void Fail(const FailureContext& context)
+    {
+        Microsoft::VisualStudio::CppUnitTestFramework::Assert::Fail(message(context).c_str());
+    }
+
+    template <typename T>
+    static void GreaterEqual(const T& expected_value, const T& actual_value, const FailureContext& context)
+    {
+        True(expected_value <= actual_value, context);
+    }
+    template <typename T>
+    static void GreaterThan(const T& expected_value, const T& actual_value, const FailureContext& context)
+    {
+        True(expected_value < actual_value, context);
+    }
+
+
+    template <typename T>
+    static void LessEqual(const T& expected_value, const T& actual_value, const FailureContext& context)
+    {
+        True(expected_value >= actual_value, context);
+    }
+    template <typename T>
+    static void LessThan(const T& expected_value, const T& actual_value, const FailureContext& context)
+    {
+        True(expected_value > actual_value, context);
+    }
+
+    template <typename T>
+    static void BeApproximately(const T& expected_value, const T& actual_value, const T& tolerance,
+        const FailureContext& context)
+    {
+        const T difference = actual_value < expected_value ? expected_value - actual_value : actual_value - expected_value;
+        True(difference <= tolerance, context);
+    }
+
+    static std::string GetStackMessage(const FailureContext& context)
+    {
+        // TODO: Use the Windows `__LineInfo(const wchar_t* pszFileName, const char* pszFuncName, int lineNumber)`
+        // and pass into the asserts above
+        auto message = "Location: @ [" + std::string(context.file()) + "(" + std::to_string(context.line()) + ")]";
+        if (!context.empty())
+        {
+            message += "\nMessage : " + context.Message();
+        }
+        return message;
+    }
+
+};
+#endif
+
+#if CHAMOIS_UNITTEST_FRAMEWORK == CHAMOIS_UNITTEST_FRAMEWORK_GTEST
+// https://google.github.io/googletest/advanced.html#asserting-on-subroutines-with-an-exception
+class ThrowListener : public testing::EmptyTestEventListener
+{
+    // [DebuggerStepThrough] equivalent ??
+    void OnTestPartResult(const testing::TestPartResult& result) override
+    {
+        if (result.type() == testing::TestPartResult::kFatalFailure)
+        {
+            // TODO: Replace filename and line number in "new" TestPartResult
+            testing::TestPartResult result1(testing::TestPartResult::kFatalFailure, "", 0, result.message());
+            throw testing::AssertionException(result1);
+        }
+    }
+};
+
+///
+/// The streamed `<< GetStackMessage(context)` is only evaluated by the GTest macros when the assertion fails
+class GTestAssert
+{
+public:
+    void static SetThrowListener()
+    {
+        // See https://google.github.io/googletest/advanced.html#asserting-on-subroutines-with-an-exception
+        // and search for "Propagating Fatal Failures"
+        // The initialisation of a function local static runs exactly once, even when the first failures race on several threads.
+        // GTest owns the listener once it is appended.
+        // If this does not fire then check that `GTEST_REMOVE_LEGACY_TEST_CASEAPI_` has been set in all test projects
+        [[maybe_unused]] static const bool registered = [] {
+            testing::UnitTest::GetInstance()->listeners().Append(new ThrowListener());  // NOLINT(cppcoreguidelines-owning-memory)
+            return true;
+        }();
+    }
+
+public:
+    template <float>
+    static void Equal(const float& expected_value, const float& actual_value, const FailureContext& context)
+    {
+        SetThrowListener();
+        ASSERT_FLOAT_EQ(expected_value, actual_value) << GetStackMessage(context);
+    }
+    template <double>
+    static void Equal(const double& expected_value, const double& actual_value, const FailureContext& context)
+    {
+        SetThrowListener();
+        ASSERT_DOUBLE_EQ(expected_value, actual_value) << GetStackMessage(context);
+    }
+    template <typename T>
+    static void Equal(const T& expected_value, const T& actual_value, const FailureContext& context)
+    {
+        SetThrowListener();
+        ASSERT_EQ(expected_value, actual_value) << GetStackMessage(context);
+    }
+
+    template <typename T>
+    static void NotEqual(const T& expected_value, const T& actual_value, const FailureContext& context)
+    {
+        SetThrowListener();
+        ASSERT_NE(expected_value, actual_value) << GetStackMessage(context);
+    }
+
+    // GTest prints a `std::wstring_view` as a container of characters, so only widen to `std::wstring` once they differ
+    static void Equal(const std::wstring_view expected_value, const std::wstring_view actual_value, const FailureContext& context)
+    {
+        SetThrowListener();
+        if (expected_value != actual_value)
+        {
+            ASSERT_EQ(std::wstring(expected_value), std::wstring(actual_value)) << GetStackMessage(context);
+        }
+    }
+
+    static void NotEqual(const std::wstring_view expected_value, const std::wstring_view actual_value, const FailureContext& context)
+    {
+        SetThrowListener();
+        if (expected_value == actual_value)
+        {
+            ASSERT_NE(std::wstring(expected_value), std::wstring(actual_value)) << GetStackMessage(context);
+        }
+    }
+
+    template <typename T>
+    static void GreaterThan(const T& expected_value, const T& actual_value, const FailureContext& context)
+    {
+        SetThrowListener();
+        ASSERT_GT(actual_value, expected_value) << GetStackMessage(context);
+    }
+
+    template <typename T>
+    static void GreaterEqual(const T& expected_value, const T& actual_value, const FailureContext& context)
+    {
+        SetThrowListener();
+        ASSERT_GE(actual_value, expected_value) << GetStackMessage(context);
+    }
+
+    template <typename T>
+    static void LessThan(const T& expected_value, const T& actual_value, const FailureContext& context)
+    {
+        SetThrowListener();
+        ASSERT_LT(actual_value, expected_value) << GetStackMessage(context);
+    }
+
+    template <typename T>
+    static void LessEqual(const T& expected_value, const T& actual_value, const FailureContext& context)
+    {
+        SetThrowListener();
+        ASSERT_LE(actual_value, expected_value) << GetStackMessage(context);
+    }
+
+    template <typename T>
+    static void BeApproximately(const T& expected_value, const T& actual_value, const T& tolerance,
+        const FailureContext& context)
+    {
+        SetThrowListener();
+        ASSERT_NEAR(actual_value, expected_value, tolerance) << GetStackMessage(context);
+    }
+
+    static void True(const bool& actual_value, const FailureContext& context)
+    {
+        SetThrowListener();
+        ASSERT_TRUE(actual_value) << GetStackMessage(context);
+    }
+
+    static void False(const bool& actual_value, const FailureContext& context)
+    {
+        SetThrowListener();
+        ASSERT_FALSE(actual_value) << GetStackMessage(context);
+    }
+
+    static void Fail(const FailureContext& context)
+    {
+        SetThrowListener();
+        ASSERT_TRUE(false) << GetStackMessage(context);
+    }
+
+    static std::string GetStackMessage(const FailureContext& context)
+    {
+        auto message = "Location: @ [" + std::string(context.file()) + "(" + std::to_string(context.line()) + ")]";
+        if (!context.empty())
+        {
+            message += "\nMessage : " + context.Message();
+        }
+        return message;
+    }
+};
+#endif
+
+#if CHAMOIS_UNITTEST_FRAMEWORK == CHAMOIS_UNITTEST_FRAMEWORK_BOOST
+// `BOOST_TEST_TOOL_IMPL` at the REQUIRE level, reported at the file and line of the assertion in the test: the Boost
+// macros report at their own `__FILE__` and `__LINE__`, which would be this header for every failure
+#define CHAMOIS_BOOST_REQUIRE(context, frwd_type, P, assertion_descr, CT, ARGS)                                      \
+    do                                                                                                              \
+    {                                                                                                               \
+        const ::boost::unit_test::const_string chamois_file((context).file());                                     \
+        const std::size_t chamois_line = static_cast<std::size_t>((context).line());                               \
+        ::boost::unit_test::unit_test_log.set_checkpoint(chamois_file, chamois_line);                              \
+        ::boost::test_tools::tt_detail::BOOST_PP_IF(frwd_type, report_assertion, check_frwd)(                      \
+            BOOST_JOIN(BOOST_TEST_TOOL_PASS_PRED, frwd_type)(P, ARGS), BOOST_TEST_LAZY_MSG(assertion_descr),       \
+            chamois_file, chamois_line, ::boost::test_tools::tt_detail::REQUIRE,                                   \
+            ::boost::test_tools::tt_detail::CT BOOST_JOIN(BOOST_TEST_TOOL_PASS_ARGS, frwd_type)(ARGS));            \
+    } while (::boost::test_tools::tt_detail::dummy_cond())
+
+///
+/// The `context` is handed to Boost as a lazy message, so it is only streamed when the assertion fails
+class BoostTestAssert
+{
+public:
+    template <typename T> static void Equal(const T& expected_value, const T& actual_value, const FailureContext& context)
+    {
+        if (context.empty())
+        {
+            CHAMOIS_BOOST_REQUIRE(context, 0, ::boost::test_tools::tt_detail::equal_impl_frwd(), "", CHECK_EQUAL, (actual_value)(expected_value));
+        }
+        else
+        {
+            CHAMOIS_BOOST_REQUIRE(context, 0, ::boost::test_tools::tt_detail::equal_impl_frwd(), context, CHECK_MSG, (actual_value)(expected_value));
+        }
+    }
+
+    static void Equal(const char* expected_value, const char* actual_value, const FailureContext& context)
+    {
+        if (context.empty())
+        {
+            CHAMOIS_BOOST_REQUIRE(context, 0, ::boost::test_tools::tt_detail::equal_impl_frwd(), "", CHECK_EQUAL, (actual_value)(expected_value));
+        }
+        else
+        {
+            CHAMOIS_BOOST_REQUIRE(context, 0, ::boost::test_tools::tt_detail::equal_impl_frwd(), context, CHECK_MSG, (actual_value)(expected_value));
+        }
+    }
+
+    // The rule `Equal` applies, so that a scope collects exactly the comparisons that fail outside one
+    template <typename T> static bool Equals(const T& expected_value, const T& actual_value)
+    {
+        if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>)
+        {
+            static const auto tol = ::boost::math::fpc::percent_tolerance(0.0001);
+            return ::boost::math::fpc::close_at_tolerance<T>(tol)(expected_value, actual_value);
+        }
+        else
+        {
+            return expected_value == actual_value;
+        }
+    }
+
+    static void Equal(const float& expected_value, const float& actual_value, const FailureContext& context)
+    {
+        static auto tol = ::boost::math::fpc::percent_tolerance(0.0001);
+        if (context.empty())
+        {
+            CHAMOIS_BOOST_REQUIRE(context, 0, ::boost::test_tools::check_is_close_t(), "", CHECK_CLOSE_FRACTION, (actual_value)(expected_value)(tol));
+        }
+        else
+        {
+            CHAMOIS_BOOST_REQUIRE(context, 0, ::boost::test_tools::check_is_close_t(), context, CHECK_MSG, (expected_value)(actual_value)(tol));
+        }
+    }
+
+    static void Equal(const double& expected_value, const double& actual_value, const FailureContext& context)
+    {
+        static auto tol = ::boost::math::fpc::percent_tolerance(0.0001);
+        if (context.empty())
+        {
+            CHAMOIS_BOOST_REQUIRE(context, 0, ::boost::test_tools::check_is_close_t(), "", CHECK_CLOSE_FRACTION, (actual_value)(expected_value)(tol));
+        }
+        else
+        {
+            CHAMOIS_BOOST_REQUIRE(context, 0, ::boost::test_tools::check_is_close_t(), context, CHECK_MSG, (expected_value)(actual_value)(tol));
+        }
+    }
+
+    template <typename T>
+    static void NotEqual(const T& expected_value, const T& actual_value, const FailureContext& context)
+    {
+        if (context.empty())
+        {
+            CHAMOIS_BOOST_REQUIRE(context, 0, ::boost::test_tools::tt_detail::ne_impl(), "", CHECK_NE, (actual_value)(expected_value));
+        }
+        else
+        {
+            CHAMOIS_BOOST_REQUIRE(context, 0, ::boost::test_tools::tt_detail::ne_impl(), context, CHECK_MSG, (actual_value)(expected_value));
+        }
+    }
+
+    // Boost cannot print a `std::wstring`, so wide strings are compared as they are, and only narrowed to UTF-8 once
+    // they differ. With a message, Boost prints only the message, so the values go in it
+    static void Equal(const std::wstring_view expected_value, const std::wstring_view actual_value, const FailureContext& context)
+    {
+        if (expected_value != actual_value)
+        {
+            const std::string expected_text = Narrow(expected_value);
+            const std::string actual_text = Narrow(actual_value);
+            // Only wchar_t values past the last code point can narrow alike, and Boost would then pass them
+            if (context.empty() && expected_text != actual_text)
+            {
+                CHAMOIS_BOOST_REQUIRE(context, 0, ::boost::test_tools::tt_detail::equal_impl_frwd(), "", CHECK_EQUAL, (actual_text)(expected_text));
+                return;
+            }
+            const std::string reason = "Expected L\"" + actual_text + "\" to be L\"" + expected_text + "\"";
+            Fail(context.reason().empty() ? context.WithReason(reason) : context);
+        }
+    }
+
+    static void Equal(const std::wstring& expected_value, const std::wstring& actual_value, const FailureContext& context)
+    {
+        Equal(std::wstring_view(expected_value), std::wstring_view(actual_value), context);
+    }
+
+    static void Equal(const wchar_t* expected_value, const wchar_t* actual_value, const FailureContext& context)
+    {
+        Equal(std::wstring_view(expected_value), std::wstring_view(actual_value), context);
+    }
+
+    static void NotEqual(const std::wstring_view expected_value, const std::wstring_view actual_value, const FailureContext& context)
+    {
+        if (expected_value == actual_value)
+        {
+            const std::string text = Narrow(actual_value);
+            if (context.empty())
+            {
+                CHAMOIS_BOOST_REQUIRE(context, 0, ::boost::test_tools::tt_detail::ne_impl(), "", CHECK_NE, (text)(text));
+                return;
+            }
+            const std::string reason = "Expected L\"" + text + "\" not to be L\"" + text + "\"";
+            Fail(context.reason().empty() ? context.WithReason(reason) : context);
+        }
+    }
+
+    static void NotEqual(const std::wstring& expected_value, const std::wstring& actual_value, const FailureContext& context)
+    {
+        NotEqual(std::wstring_view(expected_value), std::wstring_view(actual_value), context);
+    }
+
+    static void NotEqual(const wchar_t* expected_value, const wchar_t* actual_value, const FailureContext& context)
+    {
+        NotEqual(std::wstring_view(expected_value), std::wstring_view(actual_value), context);
+    }
+
+    static void True(const bool& actual_value, const FailureContext& context)
+    {
+        if (context.empty())
+        {
+            CHAMOIS_BOOST_REQUIRE(context, 2, (actual_value), "actual_value", CHECK_PRED, _);
+        }
+        else
+        {
+            CHAMOIS_BOOST_REQUIRE(context, 2, (actual_value), context, CHECK_MSG, _);
+        }
+    }
+
+    static void False(const bool& actual_value, const FailureContext& context)
+    {
+        if (context.empty())
+        {
+            CHAMOIS_BOOST_REQUIRE(context, 2, (!actual_value), "!actual_value", CHECK_PRED, _);
+        }
+        else
+        {
+            CHAMOIS_BOOST_REQUIRE(context, 2, (!actual_value), context, CHECK_MSG, _);
+        }
+    }
+
+    static void Fail(const FailureContext& context)
+    {
+        CHAMOIS_BOOST_REQUIRE(context, 2, (false), context, CHECK_MSG, _);
+    }
+
+    template <typename T>
+    static void GreaterThan(const T& expected_value, const T& actual_value, const FailureContext& context)
+    {
+        if (context.empty())
+        {
+            CHAMOIS_BOOST_REQUIRE(context, 0, ::boost::test_tools::tt_detail::gt_impl(), "", CHECK_GT, (actual_value)(expected_value));
+        }
+        else
+        {
+            CHAMOIS_BOOST_REQUIRE(context, 0, ::boost::test_tools::tt_detail::gt_impl(), context, CHECK_MSG, (actual_value)(expected_value));
+        }
+    }
+
+    template <typename T>
+    static void GreaterEqual(const T& expected_value, const T& actual_value, const FailureContext& context)
+    {
+        if (context.empty())
+        {
+            CHAMOIS_BOOST_REQUIRE(context, 0, ::boost::test_tools::tt_detail::ge_impl(), "", CHECK_GE, (actual_value)(expected_value));
+        }
+        else
+        {
+            CHAMOIS_BOOST_REQUIRE(context, 0, ::boost::test_tools::tt_detail::ge_impl(), context, CHECK_MSG, (actual_value)(expected_value));
+        }
+    }
+
+    template <typename T>
+    static void LessThan(const T& expected_value, const T& actual_value, const FailureContext& context)
+    {
+        if (context.empty())
+        {
+            CHAMOIS_BOOST_REQUIRE(context, 0, ::boost::test_tools::tt_detail::lt_impl(), "", CHECK_LT, (actual_value)(expected_value));
+        }
+        else
+        {
+            CHAMOIS_BOOST_REQUIRE(context, 0, ::boost::test_tools::tt_detail::lt_impl(), context, CHECK_MSG, (actual_value)(expected_value));
+        }
+    }
+
+    template <typename T>
+    static void LessEqual(const T& expected_value, const T& actual_value, const FailureContext& context)
+    {
+        if (context.empty())
+        {
+            CHAMOIS_BOOST_REQUIRE(context, 0, ::boost::test_tools::tt_detail::le_impl(), "", CHECK_LE, (actual_value)(expected_value));
+        }
+        else
+        {
+            CHAMOIS_BOOST_REQUIRE(context, 0, ::boost::test_tools::tt_detail::le_impl(), context, CHECK_MSG, (actual_value)(expected_value));
+        }
+    }
+
+    template <typename T>
+    static void BeApproximately(const T& expected_value, const T& actual_value, const T& tolerance,
+        const FailureContext& context)
+    {
+        const T difference = actual_value < expected_value ? expected_value - actual_value : actual_value - expected_value;
+        if (context.empty())
+        {
+            CHAMOIS_BOOST_REQUIRE(context, 0, ::boost::test_tools::tt_detail::le_impl(), "", CHECK_LE, (difference)(tolerance));
+        }
+        else
+        {
+            CHAMOIS_BOOST_REQUIRE(context, 0, ::boost::test_tools::tt_detail::le_impl(), context, CHECK_MSG, (difference)(tolerance));
+        }
+    }
+
+    static std::string GetStackMessage(const FailureContext& context)
+    {
+        // DO nothing as Boost stacks traces the error ;-)
+        return context.Message();
+    }
+
+};
+#endif
+
+#if CHAMOIS_UNITTEST_FRAMEWORK == CHAMOIS_UNITTEST_FRAMEWORK_CATCH2
+///
+/// Catch2 stringifies `INFO` / `CAPTURE` eagerly, so the message is only built once the check has already failed
+class Catch2TestAssert
+{
+public:
+    template <typename T> static void Equal(const T& expected_value, const T& actual_value, const FailureContext& context)
+    {
+        if (!(actual_value == expected_value))
+        {
+            UNSCOPED_INFO(GetStackMessage(context));
+            REQUIRE(actual_value == expected_value);
+        }
+    }
+    static void Equal(const char* expected_value, const char* actual_value, const FailureContext& context)
+    {
+        if (std::string_view(actual_value) != std::string_view(expected_value))
+        {
+            UNSCOPED_INFO(GetStackMessage(context));
+            REQUIRE_THAT(actual_value, Catch::Matchers::Equals(expected_value, Catch::CaseSensitive::Yes));
+        }
+    }
+    /*
+    template <> static void Equal(const float& expected_value, const float& actual_value, const std::string& because)
+                {
+                    static auto tol = ::boost::math::fpc::percent_tolerance(0.0001);
+                    if (because.empty())
+                    {
+                        BOOST_REQUIRE_CLOSE_FRACTION(actual_value, expected_value, tol);
+                    }
+                    else
+                    {
+                        BOOST_TEST_TOOL_IMPL(0, ::boost::test_tools::check_is_close_t(), because, REQUIRE, CHECK_MSG, (expected_value)(actual_value)(tol));
+                    }
+                }
+
+                template <> static void Equal(const double& expected_value, const double& actual_value, const std::string& because)
+                {
+                    static auto tol = ::boost::math::fpc::percent_tolerance(0.0001);
+                    if (because.empty())
+                    {
+                        BOOST_REQUIRE_CLOSE_FRACTION(actual_value, expected_value, tol);
+                    }
+                    else
+                    {
+                        BOOST_TEST_TOOL_IMPL(0, ::boost::test_tools::check_is_close_t(), because, REQUIRE, CHECK_MSG, (expected_value)(actual_value)(tol));
+                    }
+                }
+    */
+    template <typename T>
+    static void NotEqual(const T& expected_value, const T& actual_value, const FailureContext& context)
+    {
+        if (!(actual_value != expected_value))
+        {
+            UNSCOPED_INFO(GetStackMessage(context));
+            REQUIRE(actual_value != expected_value);
+        }
+    }
+    /*
+    static void Equal(const wchar_t* expected_value, const wchar_t* actual_value, const std::string& because)
+    {
+        Equal(std::wstring(expected_value), std::wstring(actual_value), because);
+    }
+
+    static void Equal(const std::wstring& expected_value, const std::wstring& actual_value, const std::string& because)
+    {
+        boost::hash<std::wstring> x1;
+        boost::hash<std::wstring> x2;
+        if (because.empty())
+        {
+            //binary '<<' : no operator found which takes a right - hand operand of type'const std::wstring' (or there is no acceptable conversion)
+            BOOST_REQUIRE_EQUAL(x1(actual_value), x2(expected_value));
+        }
+        else
+        {
+            BOOST_TEST_TOOL_IMPL(0, ::boost::test_tools::tt_detail::equal_impl_frwd(), because, REQUIRE, CHECK_MSG, (x1(actual_value))(x2(expected_value)));
+        }
+    }
+
+    static void NotEqual(const wchar_t* expected_value, const wchar_t* actual_value, const std::string& because)
+    {
+        NotEqual(std::wstring(expected_value), std::wstring(actual_value), because);
+    }
+
+    static void NotEqual(const std::wstring& expected_value, const std::wstring& actual_value, const std::string& because)
+    {
+        boost::hash<std::wstring> x1;
+        boost::hash<std::wstring> x2;
+        if (because.empty())
+        {
+            //binary '<<' : no operator found which takes a right - hand operand of type'const std::wstring' (or there is no acceptable conversion)
+            BOOST_REQUIRE_NE(x1(actual_value), x2(expected_value));
+        }
+        else
+        {
+            BOOST_TEST_TOOL_IMPL(0, ::boost::test_tools::tt_detail::ne_impl(), because, REQUIRE, CHECK_MSG, (x1(actual_value))(x2(expected_value)));
+        }
+    }
+    */
+    static void True(const bool& actual_value, const FailureContext& context)
+    {
+        if (!actual_value)
+        {
+            UNSCOPED_INFO(GetStackMessage(context));
+            REQUIRE(actual_value);
+        }
+    }
+
+    template <typename T>
+    static void BeApproximately(const T& expected_value, const T& actual_value, const T& tolerance,
+        const FailureContext& context)
+    {
+        if (!Catch::Matchers::WithinAbs(expected_value, tolerance).match(actual_value))  // NOLINT(clang-diagnostic-implicit-int-float-conversion)
+        {
+            UNSCOPED_INFO(GetStackMessage(context));
+            REQUIRE_THAT(actual_value, Catch::Matchers::WithinAbs(expected_value, tolerance));  // NOLINT(clang-diagnostic-implicit-int-float-conversion)
+        }
+    }
+
+    static void False(const bool& actual_value, const FailureContext& context)
+    {
+        if (actual_value)
+        {
+            UNSCOPED_INFO(GetStackMessage(context));
+            REQUIRE_FALSE(actual_value);
+        }
+    }
+
+    static void Fail(const FailureContext& context)
+    {
+        UNSCOPED_INFO(GetStackMessage(context)); REQUIRE(false);
+    }
+
+    template <typename T>
+    static void GreaterThan(const T& expected_value, const T& actual_value, const FailureContext& context)
+    {
+        if (!(actual_value > expected_value))
+        {
+            UNSCOPED_INFO(GetStackMessage(context));
+            REQUIRE(actual_value > expected_value);
+        }
+    }
+
+    template <typename T>
+    static void GreaterEqual(const T& expected_value, const T& actual_value, const FailureContext& context)
+    {
+        if (!(actual_value >= expected_value))
+        {
+            UNSCOPED_INFO(GetStackMessage(context));
+            REQUIRE(actual_value >= expected_value);
+        }
+    }
+
+    template <typename T>
+    static void LessThan(const T& expected_value, const T& actual_value, const FailureContext& context)
+    {
+        if (!(actual_value < expected_value))
+        {
+            UNSCOPED_INFO(GetStackMessage(context));
+            REQUIRE(actual_value < expected_value);
+        }
+    }
+
+    template <typename T>
+    static void LessEqual(const T& expected_value, const T& actual_value, const FailureContext& context)
+    {
+        if (!(actual_value <= expected_value))
+        {
+            UNSCOPED_INFO(GetStackMessage(context));
+            REQUIRE(actual_value <= expected_value);
+        }
+    }
+
+    static std::string GetStackMessage(const FailureContext& context)
+    {
+        // TODO: Use the Windows `__LineInfo(const wchar_t* pszFileName, const char* pszFuncName, int lineNumber)`
+        // and pass into the asserts above
+        auto message = "Location: @ [" + std::string(context.file()) + "(" + std::to_string(context.line()) + ")]";
+        if (!context.empty())
+        {
+            message += "\nMessage : " + context.Message();
+        }
+        return message;
+    }
+
+};
+#endif
+
+///
+/// Failure path only: appends whatever is streamed into it to a string, so `Describe` does not need `<sstream>`
+class StringStreamBuffer : public std::streambuf
+{
+public:
+    explicit StringStreamBuffer(std::string& text) : m_text(text)
+    {
+    }
+
+protected:
+    int_type overflow(const int_type character) override
+    {
+        if (!traits_type::eq_int_type(character, traits_type::eof()))
+        {
+            m_text += traits_type::to_char_type(character);
+        }
+        return traits_type::not_eof(character);
+    }
+
+    std::streamsize xsputn(const char_type* characters, const std::streamsize count) override
+    {
+        m_text.append(characters, static_cast<size_t>(count));
+        return count;
+    }
+
+private:
+    std::string& m_text;
+};
+
+template <typename T, typename = void> constexpr bool IsStreamable = false;
+template <typename T>
+constexpr bool IsStreamable<T, std::void_t<decltype(std::declval<std::ostream&>() << std::declval<const T&>())>> = true;
+
+///
+/// Failure path only: a value of a failed assertion as text, for when the backend is not the one printing it
+template <typename T> std::string Describe(const T& value)
+{
+    if constexpr (std::is_same_v<T, bool>)
+    {
+        return value ? "true" : "false";
+    }
+    else if constexpr (std::is_integral_v<T> && sizeof(T) == 1)
+    {
+        return std::to_string(static_cast<int>(value));
+    }
+    else if constexpr (std::is_floating_point_v<T>)
+    {
+        // The shortest text that reads back as the same value, so 0.1 + 0.2 is not shown as 0.3 as a stream would
+        std::array<char, 64> text{};
+        const auto end = std::to_chars(text.data(), text.data() + text.size(), value).ptr;
+        return std::string(text.data(), end);
+    }
+    else if constexpr (std::is_convertible_v<const T&, std::string_view>)
+    {
+        return "\"" + Narrow(std::string_view(value)) + "\"";
+    }
+    else if constexpr (std::is_convertible_v<const T&, std::wstring_view>)
+    {
+        return "L\"" + Narrow(std::wstring_view(value)) + "\"";
+    }
+    else if constexpr (IsStreamable<T>)
+    {
+        std::string text;
+        StringStreamBuffer buffer(text);
+        std::ostream stream(&buffer);
+        stream << value;
+        return text;
+    }
+    else
+    {
+        return "{unprintable " + std::to_string(sizeof(T)) + " byte object}";
+    }
+}
+
+///
+/// While one is current on a thread, failures on that thread are handed to it instead of to the backend.
+/// The one for other threads takes the failures of every thread that has no collector of its own, other than the
+/// threads that own it, so that they can be reported on the test thread.
+/// See `AssertionScope` and `ThreadAssertionScope` in ChamoisScope.hpp
+class FailureCollector
+{
+public:
+    [[nodiscard]] static FailureCollector*& Current() noexcept
+    {
+        thread_local FailureCollector* current = nullptr;
+        return current;
+    }
+
+    [[nodiscard]] static std::atomic<FailureCollector*>& ForOtherThreads() noexcept
+    {
+        static std::atomic<FailureCollector*> for_other_threads{ nullptr };
+        return for_other_threads;
+    }
+
+    /// Set on the threads that own the collector for other threads, whose own failures still go to the backend
+    [[nodiscard]] static bool& OwnsForOtherThreads() noexcept
+    {
+        thread_local bool owns = false;
+        return owns;
+    }
+
+    /// Where a failure on this thread goes, or nullptr for the backend
+    [[nodiscard]] static FailureCollector* Find() noexcept
+    {
+        if (FailureCollector* current = Current(); current != nullptr)
+        {
+            return current;
+        }
+        return OwnsForOtherThreads() ? nullptr : ForOtherThreads().load(std::memory_order_acquire);
+    }
+
+    /// `description` says what was expected and what was found, where the check has the values to say so
+    virtual void Collect(const FailureContext& context, std::string_view description) = 0;
+
+protected:
+    FailureCollector() = default;
+    FailureCollector(const FailureCollector&) = delete;
+    FailureCollector& operator=(const FailureCollector&) = delete;
+    ~FailureCollector() = default;
+};
+
+///
+/// Element types whose `==` is the comparison of their bytes, so arrays of them are compared as memory.
+/// Specialise it as `std::true_type` for a trivially copyable type with no padding whose `==` compares every member
+template <typename T>
+struct IsBitwiseComparable : std::bool_constant<std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>>
+{
+};
+
+///
+/// The index of the first element at which the two differ, or `count` when they do not
+template <typename T> size_t FirstMismatch(const T* lhs, const T* rhs, const size_t count)
+{
+    if constexpr (IsBitwiseComparable<T>::value)
+    {
+        return FirstMismatchBytes(reinterpret_cast<const unsigned char*>(lhs), reinterpret_cast<const unsigned char*>(rhs),
+            count * sizeof(T)) / sizeof(T);
+    }
+    else
+    {
+        size_t i = 0;
+        while (i < count && !(lhs[i] != rhs[i]))
+        {
+            ++i;
+        }
+        return i;
+    }
+}
+
+///
+/// The index of the first element equal to `value`, or `count` when there is none
+template <typename T> size_t FindElement(const T* data, const size_t count, const T& value)
+{
+    if constexpr (IsBitwiseComparable<T>::value && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8))
+    {
+        return FindElementBytes<sizeof(T)>(reinterpret_cast<const unsigned char*>(data), count,
+            reinterpret_cast<const unsigned char*>(&value));
+    }
+    else
+    {
+        size_t i = 0;
+        while (i < count && !(data[i] == value))
+        {
+            ++i;
+        }
+        return i;
+    }
+}
+
+#ifndef CHAMOIS_MISMATCH_INDEX_LIMIT
+/// How many of the differing indices a failed array or container comparison lists
+#define CHAMOIS_MISMATCH_INDEX_LIMIT 10
+#endif
+
+///
+/// Failure path only: one pass over the mismatches of an array or container comparison, counted into fixed size
+/// storage (nothing is allocated per element), then reported as a single failure:
+///     "3 of 1000 elements differ, first at index 2, last at index 998"
+///     "At indices: 2, 500, 998"
+///     "First: expected 3, found 4"
+///     "Differences (actual - expected): +1 x 2, -2 x 1"
+/// The histogram of differences, for arithmetic elements only, keeps the first few distinct differences and
+/// counts the rest together.
+template <typename T, typename TFormat> class MismatchSummary
+{
+public:
+    /// `format` turns an element into text, it is only used for the first mismatch
+    MismatchSummary(const size_t compared, const TFormat format) : m_compared(compared), m_format(format)
+    {
+    }
+
+    void Add(const size_t index, const T& expected, const T& actual)
+    {
+        if (m_count == 0)
+        {
+            m_first = index;
+            m_first_values = "expected " + m_format(expected) + ", found " + m_format(actual);
+        }
+        if (m_count < m_indices.size())
+        {
+            m_indices[m_count] = index;
+        }
+        ++m_count;
+        m_last = index;
+        if constexpr (HasHistogram)
+        {
+            AddDifference(Difference(expected, actual));
+        }
+    }
+
+    [[nodiscard]] size_t Count() const noexcept
+    {
+        return m_count;
+    }
+
+    /// For when the number of elements compared is only known at the end of the pass
+    void SetCompared(const size_t compared) noexcept
+    {
+        m_compared = compared;
+    }
+
+    [[nodiscard]] std::string Text() const
+    {
+        std::string text = std::to_string(m_count) + " of " + std::to_string(m_compared) +
+            (m_compared == 1 ? " element differs" : " elements differ");
+        if (m_count == 0)
+        {
+            return text;
+        }
+        text += ", first at index " + std::to_string(m_first) + ", last at index " + std::to_string(m_last);
+        text += "\nAt indices: ";
+        const size_t listed = m_count < m_indices.size() ? m_count : m_indices.size();
+        for (size_t i = 0; i < listed; ++i)
+        {
+            text += (i == 0 ? "" : ", ") + std::to_string(m_indices[i]);
+        }
+        if (m_count > listed)
+        {
+            text += ", ... (" + std::to_string(m_count - listed) + " more)";
+        }
+        text += "\nFirst: " + m_first_values;
+        if constexpr (HasHistogram)
+        {
+            text += "\nDifferences (actual - expected): ";
+            for (size_t i = 0; i < m_buckets; ++i)
+            {
+                text += (i == 0 ? "" : ", ") + std::string(m_differences[i] > 0 ? "+" : "") +
+                    Describe(m_differences[i]) + " x " + std::to_string(m_difference_counts[i]);
+            }
+            if (m_other_differences > 0)
+            {
+                text += ", other x " + std::to_string(m_other_differences);
+            }
+        }
+        return text;
+    }
+
+private:
+    static constexpr bool HasHistogram = std::is_arithmetic_v<T> && !std::is_same_v<T, bool>;
+    using difference_type = std::conditional_t<std::is_floating_point_v<T>, long double, long long>;
+
+    static difference_type Difference(const T& expected, const T& actual) noexcept
+    {
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            return static_cast<long double>(actual) - static_cast<long double>(expected);
+        }
+        else
+        {
+            // Modulo 2^64, which is exact whenever the difference fits
+            return static_cast<long long>(static_cast<unsigned long long>(actual) - static_cast<unsigned long long>(expected));
+        }
+    }
+
+    void AddDifference(const difference_type difference) noexcept
+    {
+        for (size_t i = 0; i < m_buckets; ++i)
+        {
+            if (m_differences[i] == difference)
+            {
+                ++m_difference_counts[i];
+                return;
+            }
+        }
+        if (m_buckets < m_differences.size())
+        {
+            m_differences[m_buckets] = difference;
+            m_difference_counts[m_buckets] = 1;
+            ++m_buckets;
+            return;
+        }
+        ++m_other_differences;
+    }
+
+    size_t m_compared;
+    TFormat m_format;
+    size_t m_count = 0;
+    size_t m_first = 0;
+    size_t m_last = 0;
+    std::string m_first_values;
+    std::array<size_t, CHAMOIS_MISMATCH_INDEX_LIMIT> m_indices{};
+    std::array<difference_type, 4> m_differences{};
+    std::array<size_t, 4> m_difference_counts{};
+    size_t m_buckets = 0;
+    size_t m_other_differences = 0;
+};
+
+#ifndef CHAMOIS_STRING_CONTEXT
+/// How many characters either side of the first difference a failed string comparison shows; strings no longer than
+/// twice this are shown whole, by the backend
+#define CHAMOIS_STRING_CONTEXT 32
+#endif
+
+///
+/// Failure path only: `text` with its control characters escaped, so that it stays on one line
+template <typename CharT> std::basic_string<CharT> EscapeControls(const std::basic_string_view<CharT> text)
+{
+    constexpr char digits[] = "0123456789abcdef";
+    std::basic_string<CharT> escaped;
+    escaped.reserve(text.length());
+    for (const CharT c : text)
+    {
+        if (c == CharT('\n') || c == CharT('\r') || c == CharT('\t'))
+        {
+            escaped += CharT('\\');
+            escaped += c == CharT('\n') ? CharT('n') : c == CharT('\r') ? CharT('r') : CharT('t');
+        }
+        else if (static_cast<std::make_unsigned_t<CharT>>(c) < 0x20 || c == CharT(0x7F))
+        {
+            const auto code = static_cast<unsigned>(static_cast<std::make_unsigned_t<CharT>>(c));
+            escaped += { CharT('\\'), CharT('x'), CharT(digits[code >> 4]), CharT(digits[code & 0xF]) };
+        }
+        else
+        {
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+///
+/// Failure path only: the columns `text` takes up, one a character; UTF-8 continuation bytes and UTF-16 low
+/// surrogates carry on the character before them
+template <typename CharT> size_t Columns(const std::basic_string_view<CharT> text)
+{
+    size_t columns = 0;
+    for (const CharT c : text)
+    {
+        const auto code = static_cast<std::uint32_t>(static_cast<std::make_unsigned_t<CharT>>(c));
+        columns += sizeof(CharT) == 1 ? (code & 0xC0) != 0x80 : sizeof(CharT) == 2 ? code < 0xDC00 || code > 0xDFFF : 1;
+    }
+    return columns;
+}
+
+///
+/// Failure path only: "index 2051 (line 88, column 12)", with lines and columns counted from 1
+template <typename CharT> std::string DescribePosition(const std::basic_string_view<CharT> text, const size_t index)
+{
+    size_t line = 1;
+    size_t line_start = 0;
+    for (size_t i = 0; i < index; ++i)
+    {
+        if (text[i] == CharT('\n'))
+        {
+            ++line;
+            line_start = i + 1;
+        }
+    }
+    return "index " + std::to_string(index) + " (line " + std::to_string(line) + ", column " +
+        std::to_string(index - line_start + 1) + ")";
+}
+
+///
+/// Failure path only: where two strings first differ, at `first`, and the characters either side of it:
+///     "Strings differ at index 2051 (line 88, column 12): expected 5242880 characters, found 5242880"
+///     "Expected: ...\"value\": 12,\n  \"tags\": [..."
+///     "Found:    ...\"value\": 13,\n  \"tags\": [..."
+///     "                         ^"
+/// rather than both strings whole, which for megabytes of JSON floods the log
+template <typename CharT>
+std::string DescribeStringMismatch(const std::basic_string_view<CharT> expected, const std::basic_string_view<CharT> actual,
+    const size_t first, const char* const differ = "Strings differ")
+{
+    // The window starts, and ends, on a character rather than within one
+    const auto continues = [](const std::basic_string_view<CharT> text, const size_t at) {
+        return at < text.length() && Columns(text.substr(at, 1)) == 0;
+    };
+    size_t start = first > CHAMOIS_STRING_CONTEXT ? first - CHAMOIS_STRING_CONTEXT : 0;
+    while (start < first && continues(actual, start))
+    {
+        ++start;
+    }
+    const auto window = [start, first, &continues](const std::basic_string_view<CharT> text) {
+        size_t end = first + CHAMOIS_STRING_CONTEXT < text.length() ? first + CHAMOIS_STRING_CONTEXT : text.length();
+        while (continues(text, end))
+        {
+            ++end;
+        }
+        return (start > 0 ? "..." : "") + Narrow(std::basic_string_view<CharT>(EscapeControls(text.substr(start, end - start)))) +
+            (end < text.length() ? "..." : "");
+    };
+    const size_t caret = (start > 0 ? 3 : 0) +
+        Columns(std::basic_string_view<CharT>(EscapeControls(actual.substr(start, first - start))));
+    return differ + (" at " + DescribePosition(actual, first)) + ": expected " + std::to_string(expected.length()) +
+        " characters, found " + std::to_string(actual.length()) + "\nExpected: " + window(expected) +
+        "\nFound:    " + window(actual) + "\n" + std::string(10 + caret, ' ') + "^";
+}
+
+// Small trivially copyable subjects are cheaper to hold by value than through a reference,
+// anything larger is referenced and never copied.
+template <typename T>
+using SubjectRef = std::conditional_t<std::is_trivially_copyable_v<T> && sizeof(T) <= 2 * sizeof(void*), const T, const T&>;
+
+///
+/// Static, stateless dispatch to the `TAssert` backend; it is only ever used as a template parameter.
+/// Each check accepts a passing assertion itself, and only hands a failing one to the backend (or the current
+/// FailureCollector) through the out of line `Report`, so that a passing assertion inlines down to the comparison and a branch.
+/// Equality is the backend's own `Equals` where it has one (Boost compares floats to within a tolerance), so that
+/// a scope, which never asks the backend, fails exactly the assertions the backend would.
+template <class TAssert> class TAssertInternal
+{
+public:
+    TAssertInternal() = delete;
+
+    template <typename T>
+    static void AssertEqual(const T& expected_value, const T& actual_value, const FailureContext& context)
+    {
+        if (!Equals(expected_value, actual_value))
+        {
+            ReportComparison<T>(
+                [](const FailureContext& failure, const T& expected, const T& actual) { TAssert::Equal(expected, actual, failure); },
+                "to be", context, expected_value, actual_value);
+        }
+    }
+
+    template <typename T>
+    static void AssertNotEqual(const T& expected_value, const T& actual_value, const FailureContext& context)
+    {
+        if (!(expected_value != actual_value))
+        {
+            ReportComparison<T>(
+                [](const FailureContext& failure, const T& expected, const T& actual) { TAssert::NotEqual(expected, actual, failure); },
+                "not to be", context, expected_value, actual_value);
+        }
+    }
+
+    template <typename T>
+    static void AssertGreater(const T& expected_value, const T& actual_value, const FailureContext& context)
+    {
+        if (!(actual_value > expected_value))
+        {
+            ReportComparison<T>(
+                [](const FailureContext& failure, const T& expected, const T& actual) { TAssert::GreaterThan(expected, actual, failure); },
+                "to be greater than", context, expected_value, actual_value);
+        }
+    }
+
+    template <typename T>
+    static void AssertLess(const T& expected_value, const T& actual_value, const FailureContext& context)
+    {
+        if (!(actual_value < expected_value))
+        {
+            ReportComparison<T>(
+                [](const FailureContext& failure, const T& expected, const T& actual) { TAssert::LessThan(expected, actual, failure); },
+                "to be less than", context, expected_value, actual_value);
+        }
+    }
+
+    template <typename T>
+    static void AssertGreaterEqual(const T& expected_value, const T& actual_value, const FailureContext& context)
+    {
+        if (!(actual_value >= expected_value))
+        {
+            ReportComparison<T>(
+                [](const FailureContext& failure, const T& expected, const T& actual) { TAssert::GreaterEqual(expected, actual, failure); },
+                "to be greater than or equal to", context, expected_value, actual_value);
+        }
+    }
+
+    template <typename T>
+    static void AssertLessEqual(const T& expected_value, const T& actual_value, const FailureContext& context)
+    {
+        if (!(actual_value <= expected_value))
+        {
+            ReportComparison<T>(
+                [](const FailureContext& failure, const T& expected, const T& actual) { TAssert::LessEqual(expected, actual, failure); },
+                "to be less than or equal to", context, expected_value, actual_value);
+        }
+    }
+
+    template <typename T>
+    static void AssertInRange(const T& actual_value, const T& min_value, const T& max_value, const FailureContext& context)
+    {
+        if (!(min_value <= actual_value && actual_value <= max_value))
+        {
+            Report<SubjectRef<T>, SubjectRef<T>, SubjectRef<T>>(
+                [](const FailureContext& failure, const T&, const T&, const T&) { TAssert::True(false, failure); },
+                [](const T& actual, const T& min, const T& max) {
+                    return "Expected " + Describe(actual) + " to be in range [" + Describe(min) + ", " + Describe(max) + "]";
+                },
+                context, actual_value, min_value, max_value);
+        }
+    }
+
+    template <typename T>
+    static void AssertNotInRange(const T& actual_value, const T& min_value, const T& max_value,
+        const FailureContext& context)
+    {
+        if (!(min_value > actual_value || actual_value > max_value))
+        {
+            Report<SubjectRef<T>, SubjectRef<T>, SubjectRef<T>>(
+                [](const FailureContext& failure, const T&, const T&, const T&) { TAssert::True(false, failure); },
+                [](const T& actual, const T& min, const T& max) {
+                    return "Expected " + Describe(actual) + " not to be in range [" + Describe(min) + ", " + Describe(max) + "]";
+                },
+                context, actual_value, min_value, max_value);
+        }
+    }
+
+    template <typename T>
+    static void AssertBeApproximately(const T& expected_value, const T& actual_value,
+        const T& tolerance,
+        const FailureContext& context)
+    {
+        const T difference = actual_value < expected_value ? expected_value - actual_value : actual_value - expected_value;
+        if (!(difference <= tolerance))
+        {
+            Report<SubjectRef<T>, SubjectRef<T>, SubjectRef<T>>(
+                [](const FailureContext& failure, const T& expected, const T& actual, const T& within) {
+                    TAssert::BeApproximately(expected, actual, within, failure);
+                },
+                [](const T& expected, const T& actual, const T& within) {
+                    return "Expected " + Describe(actual) + " to be approximately " + Describe(expected) + " +/- " + Describe(within);
+                },
+                context, expected_value, actual_value, tolerance);
+        }
+    }
+
+    template <typename T>
+    static void AssertArrayEqual(const T* expected_values, const size_t expected_values_len, const T* actual_values,
+        const size_t actual_values_len, const FailureContext& context)
+    {
+        if (expected_values_len != actual_values_len)
+        {
+            ReportComparison<size_t>(
+                [](const FailureContext& failure, const size_t expected, const size_t actual) { TAssert::Equal(expected, actual, failure); },
+                "to be", context.WithReason("Array lengths differ"), expected_values_len, actual_values_len);
+        }
+        const auto min_len = actual_values_len < expected_values_len ? actual_values_len : expected_values_len;
+        if (const size_t first = FirstMismatch(expected_values, actual_values, min_len); first != min_len)
+        {
+            ReportArrayMismatches(expected_values, actual_values, min_len, first, context);
+        }
+    }
+
+    template <typename T>
+    static void AssertArrayNotEqual(const T* expected_values, const size_t expected_values_len, const T* actual_values,
+        const size_t actual_values_len, const FailureContext& context)
+    {
+        if (expected_values_len != actual_values_len ||
+            FirstMismatch(expected_values, actual_values, actual_values_len) != actual_values_len)
+        {
+            return;
+        }
+        Report([](const FailureContext& failure) { TAssert::Fail(failure); }, NoDescription,
+            context.WithReason("Array contents the same"));
+    }
+
+    static void AssertTrue(const bool actual_value, const FailureContext& context)
+    {
+        if (!actual_value)
+        {
+            Report([](const FailureContext& failure) { TAssert::True(false, failure); },
+                [] { return std::string("Expected true, but found false"); }, context);
+        }
+    }
+
+    static void AssertFalse(const bool actual_value, const FailureContext& context)
+    {
+        if (actual_value)
+        {
+            Report([](const FailureContext& failure) { TAssert::False(true, failure); },
+                [] { return std::string("Expected false, but found true"); }, context);
+        }
+    }
+
+    template <typename T>
+    static void AssertEqual(const T* expected_value, const T* actual_value, const FailureContext& context)
+    {
+        if (expected_value != actual_value)
+        {
+            ReportComparison<const T*>(
+                [](const FailureContext& failure, const T* expected, const T* actual) { TAssert::Equal(expected, actual, failure); },
+                "to be", context, expected_value, actual_value);
+        }
+    }
+
+    template <typename T>
+    static void AssertNotEqual(const T* expected_value, const T* actual_value, const FailureContext& context)
+    {
+        if (expected_value == actual_value)
+        {
+            ReportComparison<const T*>(
+                [](const FailureContext& failure, const T* expected, const T* actual) { TAssert::NotEqual(expected, actual, failure); },
+                "not to be", context, expected_value, actual_value);
+        }
+    }
+
+    template <typename CharT>
+    static void AssertStringEqual(const std::basic_string_view<CharT> expected_value,
+        const std::basic_string_view<CharT> actual_value, const FailureContext& context)
+    {
+        if (expected_value == actual_value)
+        {
+            return;
+        }
+        if (expected_value.length() > 2 * CHAMOIS_STRING_CONTEXT || actual_value.length() > 2 * CHAMOIS_STRING_CONTEXT)
+        {
+            ReportStringMismatch(expected_value, actual_value, context);
+            return;
+        }
+        using view_type = std::basic_string_view<CharT>;
+        ReportComparison<view_type>(
+            [](const FailureContext& failure, const view_type expected, const view_type actual) { TAssert::Equal(expected, actual, failure); },
+            "to be", context, expected_value, actual_value);
+    }
+
+    template <typename CharT>
+    static void AssertStringLength(const size_t expected_length, const std::basic_string_view<CharT> actual_string,
+        const FailureContext& context)
+    {
+        AssertEqual(expected_length, actual_string.length(), context);
+    }
+
+    template <typename CharT>
+    static void AssertNotStringLength(const size_t expected_length, const std::basic_string_view<CharT> actual_string,
+        const FailureContext& context)
+    {
+        AssertNotEqual(expected_length, actual_string.length(), context);
+    }
+
+    template <typename CharT>
+    static void AssertStringEmpty(const std::basic_string_view<CharT> actual_string, const FailureContext& context)
+    {
+        AssertEqual(size_t{ 0 }, actual_string.length(), context);
+    }
+
+    template <typename CharT>
+    static void AssertNotStringEmpty(const std::basic_string_view<CharT> actual_string, const FailureContext& context)
+    {
+        AssertNotEqual(size_t{ 0 }, actual_string.length(), context);
+    }
+
+    template <typename CharT>
+    static void AssertStringStartsWith(const std::basic_string_view<CharT> expected_prefix,
+        const std::basic_string_view<CharT> actual_string, const FailureContext& context)
+    {
+        using view_type = std::basic_string_view<CharT>;
+        if (actual_string.substr(0, expected_prefix.length()) != expected_prefix)
+        {
+            Report<view_type, view_type>(
+                [](const FailureContext& failure, const view_type prefix, const view_type actual) {
+                    TAssert::Fail(failure.WithReason(DescribeStartsWith(prefix, actual)));
+                },
+                DescribeStartsWith<CharT>, context, expected_prefix, actual_string);
+        }
+    }
+
+    template <typename CharT>
+    static void AssertStringEndsWith(const std::basic_string_view<CharT> expected_suffix,
+        const std::basic_string_view<CharT> actual_string, const FailureContext& context)
+    {
+        using view_type = std::basic_string_view<CharT>;
+        if (!actual_string.ends_with(expected_suffix))
+        {
+            Report<view_type, view_type>(
+                [](const FailureContext& failure, const view_type suffix, const view_type actual) {
+                    TAssert::Fail(failure.WithReason(DescribeEndsWith(suffix, actual)));
+                },
+                DescribeEndsWith<CharT>, context, expected_suffix, actual_string);
+        }
+    }
+
+    static void AssertFail(const FailureContext& context)
+    {
+        Report([](const FailureContext& failure) { TAssert::Fail(failure); }, NoDescription, context);
+    }
+
+    template <typename _EXPECTEDEXCEPTION, typename FUNCTOR>
+    static void Throw(const FUNCTOR func, const FailureContext& context)
+    {
+        try
+        {
+            func();
+        }
+        catch (const _EXPECTEDEXCEPTION&)
+        {
+            return;
+        }
+        catch (const std::exception& ex)
+        {
+            ReportUnexpectedException(context, ex);
+            return;
+        }
+        Report([](const FailureContext& failure) { TAssert::Fail(failure); }, NoDescription,
+            context.WithReason("Expected exception was not thrown"));
+    }
+
+    template <typename NOTEXPECTEDEXCEPTION, typename FUNCTOR>
+    static void NotThrow(const FUNCTOR func, const FailureContext& context)
+    {
+        try
+        {
+            func();
+        }
+        catch (const NOTEXPECTEDEXCEPTION& ex)
+        {
+            ReportUnexpectedException(context, ex);
+        }
+    }
+
+private:
+    static std::string NoDescription(...)
+    {
+        return {};
+    }
+
+    template <typename T, typename TReport>
+    static void ReportComparison(const TReport report, const char* expectation, const FailureContext& context,
+        const T& expected_value, const T& actual_value)
+    {
+        Report<const char*, SubjectRef<T>, SubjectRef<T>>(
+            [report](const FailureContext& failure, const char*, const T& expected, const T& actual) { report(failure, expected, actual); },
+            [](const char* expects, const T& expected, const T& actual) {
+                return "Expected " + Describe(actual) + " " + expects + " " + Describe(expected);
+            },
+            context, expectation, expected_value, actual_value);
+    }
+
+    template <typename CharT>
+    static std::string DescribeStartsWith(const std::basic_string_view<CharT> prefix, const std::basic_string_view<CharT> actual)
+    {
+        return "Actual [" + Narrow(actual) + "] does not start with [" + Narrow(prefix) + "]";
+    }
+
+    template <typename CharT>
+    static std::string DescribeEndsWith(const std::basic_string_view<CharT> suffix, const std::basic_string_view<CharT> actual)
+    {
+        return "Actual [" + Narrow(actual) + "] does not end with [" + Narrow(suffix) + "]";
+    }
+
+    static std::string DescribeUnexpectedException(const char* what)
+    {
+        return std::string("Unexpected exception thrown: ") + what;
+    }
+
+    // All the mismatches as one failure, skipping from one to the next rather than testing every element in turn
+    template <typename T>
+    CHAMOIS_COLD static void ReportArrayMismatches(const T* expected_values, const T* actual_values, const size_t length,
+        const size_t first, const FailureContext& context)
+    {
+        MismatchSummary<T, std::string (*)(const T&)> mismatches(length, &Describe<T>);
+        for (size_t i = first; i < length; i += 1 + FirstMismatch(expected_values + i + 1, actual_values + i + 1, length - i - 1))
+        {
+            mismatches.Add(i, expected_values[i], actual_values[i]);
+        }
+        const std::string summary = mismatches.Text();
+        Report([](const FailureContext& failure) { TAssert::Fail(failure); }, NoDescription,
+            context.WithReason("Array contents differ: " + summary));
+    }
+
+    // Long strings are not handed to the backend, which would print both whole
+    template <typename CharT>
+    CHAMOIS_COLD static void ReportStringMismatch(const std::basic_string_view<CharT> expected_value,
+        const std::basic_string_view<CharT> actual_value, const FailureContext& context)
+    {
+        const size_t common = expected_value.length() < actual_value.length() ? expected_value.length() : actual_value.length();
+        const size_t first = FirstMismatch(expected_value.data(), actual_value.data(), common);
+        Report([](const FailureContext& failure) { TAssert::Fail(failure); }, NoDescription,
+            context.WithReason(DescribeStringMismatch(expected_value, actual_value, first)));
+    }
+
+    static void ReportUnexpectedException(const FailureContext& context, const std::exception& ex)
+    {
+        Report<const char*>(
+            [](const FailureContext& failure, const char* what) { TAssert::Fail(failure.WithReason(DescribeUnexpectedException(what))); },
+            DescribeUnexpectedException, context, ex.what());
+    }
+
+    template <typename T> static bool Equals(const T& expected_value, const T& actual_value)
+    {
+        if constexpr (requires { TAssert::Equals(expected_value, actual_value); })
+        {
+            return TAssert::Equals(expected_value, actual_value);
+        }
+        else
+        {
+            return expected_value == actual_value;
+        }
+    }
+
+    // The failure path. The context is unpacked and the values are passed by value (or by reference when large,
+    // see SubjectRef), so that the passing path does not have to keep any of them in memory for it
+    template <typename... TArgs, typename TReport, typename TDescribe>
+    static void Report(const TReport report, const TDescribe describe, const FailureContext& context, const TArgs... args)
+    {
+        Report<TArgs...>(report, describe, context.file(), context.line(), context.because(), context.reason(), args...);
+    }
+
+    template <typename... TArgs, typename TReport, typename TDescribe>
+    CHAMOIS_COLD static void Report(const TReport report, const TDescribe describe, const char* file, const int line,
+        const std::string_view because, const std::string_view reason, const TArgs... args)
+    {
+        const FailureContext context(file, line, because, reason);
+        if (FailureCollector* collector = FailureCollector::Find(); collector != nullptr)
+        {
+            collector->Collect(context, describe(args...));
+            return;
+        }
+        report(context, args...);
+    }
+};
+
+#if CHAMOIS_UNITTEST_FRAMEWORK == CHAMOIS_UNITTEST_FRAMEWORK_MS
+typedef TAssertInternal<MsAssert> AssertInternal;
+#elif CHAMOIS_UNITTEST_FRAMEWORK == CHAMOIS_UNITTEST_FRAMEWORK_GTEST
+using AssertInternal = TAssertInternal<GTestAssert>;
+#elif CHAMOIS_UNITTEST_FRAMEWORK == CHAMOIS_UNITTEST_FRAMEWORK_BOOST
+typedef TAssertInternal<BoostTestAssert> AssertInternal;
+#elif CHAMOIS_UNITTEST_FRAMEWORK == CHAMOIS_UNITTEST_FRAMEWORK_CATCH2
+typedef TAssertInternal<Catch2TestAssert> AssertInternal;
+#else
+#error No supported test framework found
+#endif
+
+#ifndef CHAMOIS_NO_MACROS
+// The fluent verbs are macros so that `__FILE__` and `__LINE__` are those of the calling test.
+// Define CHAMOIS_NO_MACROS before including this header to use the macro free `std::source_location` members instead.
+#define Be(...) _beFunc(__FILE__, __LINE__, __VA_ARGS__)
+#define NotBe(...) _notBeFunc(__FILE__, __LINE__, __VA_ARGS__)
+#define BeZero(...) _beZeroFunc(__FILE__, __LINE__, __VA_ARGS__)
+#define BePositive(...) _bePositiveFunc(__FILE__, __LINE__, __VA_ARGS__)
+#define BeNegative(...) _beNegativeFunc(__FILE__, __LINE__, __VA_ARGS__)
+#define BeGreaterThan(...) _beGreaterThanFunc(__FILE__, __LINE__, __VA_ARGS__)
+#define BeGreaterThanOrEqual(...) _beGreaterThanOrEqualFunc(__FILE__, __LINE__, __VA_ARGS__)
+#define BeLessThan(...) _beLessThanFunc(__FILE__, __LINE__, __VA_ARGS__)
+#define BeLessThanOrEqual(...) _beLessThanOrEqualFunc(__FILE__, __LINE__, __VA_ARGS__)
+#define BeInRange(...) _beInRangeFunc(__FILE__, __LINE__, __VA_ARGS__)
+#define NotBeZero(...) _notBeZeroFunc(__FILE__, __LINE__, __VA_ARGS__)
+#define NotBeInRange(...) _notBeInRangeFunc(__FILE__, __LINE__, __VA_ARGS__)
+#define BeApproximately(...) _beApproximatelyFunc(__FILE__, __LINE__, __VA_ARGS__)
+#define BeTrue(...) _beTrueFunc(__FILE__, __LINE__, __VA_ARGS__)
+#define BeFalse(...) _beFalseFunc(__FILE__, __LINE__, __VA_ARGS__)
+#define NotBeTrue(...) _notBeTrueFunc(__FILE__, __LINE__, __VA_ARGS__)
+#define NotBeFalse(...) _notBeFalseFunc(__FILE__, __LINE__, __VA_ARGS__)
+#define HaveLength(...) _haveLengthFunc(__FILE__, __LINE__, __VA_ARGS__)
+#define NotHaveLength(...) _notHaveLengthFunc(__FILE__, __LINE__, __VA_ARGS__)
+#define BeEmpty(...) _beEmptyFunc(__FILE__, __LINE__, __VA_ARGS__)
+#define NotBeEmpty(...) _notBeEmptyFunc(__FILE__, __LINE__, __VA_ARGS__)
+#define BeEquivalentTo(...) _beEquivalentToFunc(__FILE__, __LINE__, __VA_ARGS__)
+#define NotBeEquivalentTo(...) _notBeEquivalentToFunc(__FILE__, __LINE__, __VA_ARGS__)
+#define Contain(...) _containFunc(__FILE__, __LINE__, __VA_ARGS__)
+#define NotContain(...) _notContainFunc(__FILE__, __LINE__, __VA_ARGS__)
+#define ContainAll(...) _containAllFunc(__FILE__, __LINE__, __VA_ARGS__)
+#define ContainAny(...) _containAnyFunc(__FILE__, __LINE__, __VA_ARGS__)
+#define BeInAscendingOrder(...) _beInAscendingOrderFunc(__FILE__, __LINE__, __VA_ARGS__)
+#define BeInDescendingOrder(...) _beInDescendingOrderFunc(__FILE__, __LINE__, __VA_ARGS__)
+#define HaveSameContentAs(...) _haveSameContentAsFunc(__FILE__, __LINE__, __VA_ARGS__)
+#define HaveSize(...) _haveSizeFunc(__FILE__, __LINE__, __VA_ARGS__)
+///
+/// The name mangled below to be "StartWith" and not "StartsWith" (Notice the s)
+/// Is because in Catch2 (Maybe others), there is a "StartsWith" defined function !
+#define StartWith(...) _startsWithFunc(__FILE__, __LINE__, __VA_ARGS__)
+#define EndWith(...) _endsWithFunc(__FILE__, __LINE__, __VA_ARGS__)
+#define ContainInOrder(...) _containInOrderFunc(__FILE__, __LINE__, __VA_ARGS__)
+#define MatchRegex(...) _matchRegexFunc(__FILE__, __LINE__, __VA_ARGS__)
+#define NotMatchRegex(...) _notMatchRegexFunc(__FILE__, __LINE__, __VA_ARGS__)
+#define ContainMatch(...) _containMatchFunc(__FILE__, __LINE__, __VA_ARGS__)
+#define BeEquivalentToIgnoringCase(...) _beEquivalentToIgnoringCaseFunc(__FILE__, __LINE__, __VA_ARGS__)
+#define StartWithIgnoringCase(...) _startsWithIgnoringCaseFunc(__FILE__, __LINE__, __VA_ARGS__)
+#define ContainIgnoringCase(...) _containIgnoringCaseFunc(__FILE__, __LINE__, __VA_ARGS__)
+#define MatchWildcard(...) _matchWildcardFunc(__FILE__, __LINE__, __VA_ARGS__)
+#define NotMatchWildcard(...) _notMatchWildcardFunc(__FILE__, __LINE__, __VA_ARGS__)
+#define MatchWildcardIgnoringCase(...) _matchWildcardIgnoringCaseFunc(__FILE__, __LINE__, __VA_ARGS__)
+#define BeNull(...) _beNullFunc(__FILE__, __LINE__, __VA_ARGS__)
+#define NotBeNull(...) _notBeNullFunc(__FILE__, __LINE__, __VA_ARGS__)
+#define Throw(expected_exception, ...) _throw<expected_exception>(__FILE__, __LINE__, __VA_ARGS__)
+#define NotThrow(expected_exception, ...) _notThrow<expected_exception>(__FILE__, __LINE__, __VA_ARGS__)
+#endif
+
+/* Default */
+// TStorage is SubjectRef<T>, or T when `Should()` was called on a ThatImpl owning an rvalue subject, which moves it in
+template <class TAssertImpl, typename T, typename TStorage = SubjectRef<T>> class ShouldImpl
+{
+public:
+    explicit ShouldImpl(const T& value)
+        : m_value(value)
+    {
+    }
+
+    explicit ShouldImpl(T&& value)
+        : m_value(std::move(value))
+    {
+        static_assert(std::is_same_v<TStorage, T>, "An rvalue subject must be owned by the ShouldImpl");
+    }
+
+    void _beFunc(const char* file, const int line, const T& expected_value,
+        const std::string_view because = {}) const
+    {
+        TAssertImpl::template AssertEqual<T>(expected_value, m_value, FailureContext(file, line, because));
+    }
+
+    void _notBeFunc(const char* file, const int line, const T& expected_value,
+        const std::string_view because = {}) const
+    {
+        TAssertImpl::template AssertNotEqual<T>(expected_value, m_value, FailureContext(file, line, because));
+    }
+
+#ifdef CHAMOIS_NO_MACROS
+    void Be(const T& expected_value, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        _beFunc(location.file_name(), static_cast<int>(location.line()), expected_value, because);
+    }
+
+    void NotBe(const T& expected_value, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        _notBeFunc(location.file_name(), static_cast<int>(location.line()), expected_value, because);
+    }
+#endif
+
+private:
+    const TStorage m_value;
+};
+
+// TStorage is SubjectRef<T> for lvalue subjects, or T when an rvalue subject has been moved in
+template <class TAssertImpl, typename T, typename TStorage = SubjectRef<T>> class ThatImpl
+{
+public:
+    explicit ThatImpl(const T& value)
+        : m_value(value)
+    {
+    }
+
+    explicit ThatImpl(T&& value)
+        : m_value(std::move(value))
+    {
+        static_assert(!std::is_reference_v<TStorage>, "An rvalue subject must be owned by the ThatImpl");
+    }
+
+    [[nodiscard]] const T& value() const
+    {
+        return m_value;
+    }
+
+    ShouldImpl<TAssertImpl, T> Should() &
+    {
+        return ShouldImpl<TAssertImpl, T>(m_value);
+    }
+
+    // A temporary ThatImpl hands an owned subject on, as the ShouldImpl may outlive it
+    ShouldImpl<TAssertImpl, T, TStorage> Should() &&
+    {
+        if constexpr (std::is_same_v<TStorage, T>)
+        {
+            return ShouldImpl<TAssertImpl, T, TStorage>(std::move(m_value));
+        }
+        else
+        {
+            return ShouldImpl<TAssertImpl, T>(m_value);
+        }
+    }
+
+protected:
+    TStorage m_value;
+};
+
+// Non-const rvalue subjects that are not already taken by one of the numeric, boolean or string That overloads
+template <typename T>
+constexpr bool IsOwnedSubject = !std::is_reference_v<T> && !std::is_const_v<T> && !std::is_arithmetic_v<T>;
+
+/* Numeric Types */
+template <class TAssertImpl, typename T> class ShouldNumImpl
+{
+public:
+    explicit ShouldNumImpl(const T value)
+        : m_value(value)
+    {
+    }
+
+    void _beFunc(const char* file, const int line, const T& expected_value, const std::string_view because = {})
+    {
+        TAssertImpl::template AssertEqual<T>(expected_value, m_value, FailureContext(file, line, because));
+    }
+
+    void _beZeroFunc(const char* file, const int line, const T& /*expected_value*/,
+        const std::string_view because = {}) const
+    {
+        TAssertImpl::template AssertEqual<T>(0, m_value, FailureContext(file, line, because));
+    }
+
+    void _bePositiveFunc(const char* file, const int line, const T& /*expected_value*/,
+        const std::string_view because = {}) const
+    {
+        TAssertImpl::template AssertGreaterEqual<T>(0, m_value, FailureContext(file, line, because));
+    }
+
+    void _beNegativeFunc(const char* file, const int line, const T& /*expected_value*/,
+        const std::string_view because = {}) const
+    {
+        TAssertImpl::template AssertLess<T>(0, m_value, FailureContext(file, line, because));
+    }
+
+    void _beGreaterThanFunc(const char* file, const int line, const T& expected_value,
+        const std::string_view because = {}) const
+    {
+        TAssertImpl::template AssertGreater<T>(expected_value, m_value, FailureContext(file, line, because));
+    }
+
+    void _beGreaterThanOrEqualFunc(const char* file, const int line, const T& expected_value,
+        const std::string_view because = {}) const
+    {
+        TAssertImpl::template AssertGreaterEqual<T>(expected_value, m_value, FailureContext(file, line, because));
+    }
+
+    void _beLessThanFunc(const char* file, const int line, const T& expected_value,
+        const std::string_view because = {}) const
+    {
+        TAssertImpl::template AssertLess<T>(expected_value, m_value, FailureContext(file, line, because));
+    }
+
+    void _beLessThanOrEqualFunc(const char* file, const int line, const T& expected_value,
+        const std::string_view because = {}) const
+    {
+        TAssertImpl::template AssertLessEqual<T>(expected_value, m_value, FailureContext(file, line, because));
+    }
+
+    void _beInRangeFunc(const char* file, const int line, const T& min_value, const T& max_value,
+        const std::string_view because = {}) const
+    {
+        TAssertImpl::template AssertInRange<T>(m_value, min_value, max_value, FailureContext(file, line, because));
+    }
+
+    void _notBeFunc(const char* file, const int line, const T& expected_value,
+        const std::string_view because = {}) const
+    {
+        TAssertImpl::template AssertNotEqual<T>(expected_value, m_value, FailureContext(file, line, because));
+    }
+
+    void _notBeZeroFunc(const char* file, const int line, const T& /*expected_value*/,
+        const std::string_view because = {}) const
+    {
+        TAssertImpl::template AssertNotEqual<T>(0, m_value, FailureContext(file, line, because));
+    }
+
+    void _notBeInRangeFunc(const char* file, const int line, const T& min_value, const T& max_value,
+        const std::string_view because = {}) const
+    {
+        TAssertImpl::template AssertNotInRange<T>(m_value, min_value, max_value,
+            FailureContext(file, line, because));
+    }
+
+    void _beApproximatelyFunc(const char* file, const int line, const T& expected_value,
+        const T& tolerance,
+        const std::string_view because = {}) const
+    {
+        TAssertImpl::template AssertBeApproximately<T>(expected_value, m_value, tolerance,
+            FailureContext(file, line, because));
+    }
+
+#ifdef CHAMOIS_NO_MACROS
+    void Be(const T& expected_value, const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _beFunc(location.file_name(), static_cast<int>(location.line()), expected_value, because);
+    }
+
+    void BeZero(const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        _beZeroFunc(location.file_name(), static_cast<int>(location.line()), T{}, because);
+    }
+
+    void BePositive(const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        _bePositiveFunc(location.file_name(), static_cast<int>(location.line()), T{}, because);
+    }
+
+    void BeNegative(const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        _beNegativeFunc(location.file_name(), static_cast<int>(location.line()), T{}, because);
+    }
+
+    void BeGreaterThan(const T& expected_value, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        _beGreaterThanFunc(location.file_name(), static_cast<int>(location.line()), expected_value, because);
+    }
+
+    void BeGreaterThanOrEqual(const T& expected_value, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        _beGreaterThanOrEqualFunc(location.file_name(), static_cast<int>(location.line()), expected_value, because);
+    }
+
+    void BeLessThan(const T& expected_value, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        _beLessThanFunc(location.file_name(), static_cast<int>(location.line()), expected_value, because);
+    }
+
+    void BeLessThanOrEqual(const T& expected_value, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        _beLessThanOrEqualFunc(location.file_name(), static_cast<int>(location.line()), expected_value, because);
+    }
+
+    void BeInRange(const T& min_value, const T& max_value, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        _beInRangeFunc(location.file_name(), static_cast<int>(location.line()), min_value, max_value, because);
+    }
+
+    void NotBe(const T& expected_value, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        _notBeFunc(location.file_name(), static_cast<int>(location.line()), expected_value, because);
+    }
+
+    void NotBeZero(const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        _notBeZeroFunc(location.file_name(), static_cast<int>(location.line()), T{}, because);
+    }
+
+    void NotBeInRange(const T& min_value, const T& max_value, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        _notBeInRangeFunc(location.file_name(), static_cast<int>(location.line()), min_value, max_value, because);
+    }
+
+    void BeApproximately(const T& expected_value, const T& tolerance, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        _beApproximatelyFunc(location.file_name(), static_cast<int>(location.line()), expected_value, tolerance, because);
+    }
+#endif
+
+private:
+    const T m_value;
+};
+
+template <class TAssertImpl, typename T> class ThatNumImpl
+{
+public:
+    explicit ThatNumImpl(const T value)
+        : m_value(value)
+    {
+    }
+
+    [[nodiscard]] T value() const
+    {
+        return m_value;
+    }
+
+    [[nodiscard]] ShouldNumImpl<TAssertImpl, T> Should() const
+    {
+        return ShouldNumImpl<TAssertImpl, T>(m_value);
+    }
+
+protected:
+    const T m_value;
+};
+
+/* Boolean */
+template <class TAssertImpl> class ShouldBoolImpl
+{
+public:
+    explicit ShouldBoolImpl(const bool value)
+        : m_value(value)
+    {
+    }
+
+    void _beFunc(const char* file, const int line, const bool& expected_value, const std::string_view because = {})
+    {
+        TAssertImpl::AssertEqual(expected_value, m_value, FailureContext(file, line, because));
+    }
+
+    void _notBeFunc(const char* file, const int line, const bool& expected_value,
+        const std::string_view because = {}) const
+    {
+        TAssertImpl::AssertNotEqual(expected_value, m_value, FailureContext(file, line, because));
+    }
+
+    void _beTrueFunc(const char* file, const int line, const std::string_view because = {})
+    {
+        TAssertImpl::AssertTrue(m_value, FailureContext(file, line, because));
+    }
+
+    void _beFalseFunc(const char* file, const int line, const std::string_view because = {})
+    {
+        TAssertImpl::AssertFalse(m_value, FailureContext(file, line, because));
+    }
+
+    void _notBeTrueFunc(const char* file, const int line, const std::string_view because = {})
+    {
+        TAssertImpl::AssertFalse(m_value, FailureContext(file, line, because));
+    }
+
+    void _notBeFalseFunc(const char* file, const int line, const std::string_view because = {})
+    {
+        TAssertImpl::AssertTrue(m_value, FailureContext(file, line, because));
+    }
+
+#ifdef CHAMOIS_NO_MACROS
+    void Be(const bool& expected_value, const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _beFunc(location.file_name(), static_cast<int>(location.line()), expected_value, because);
+    }
+
+    void NotBe(const bool& expected_value, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        _notBeFunc(location.file_name(), static_cast<int>(location.line()), expected_value, because);
+    }
+
+    void BeTrue(const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _beTrueFunc(location.file_name(), static_cast<int>(location.line()), because);
+    }
+
+    void BeFalse(const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _beFalseFunc(location.file_name(), static_cast<int>(location.line()), because);
+    }
+
+    void NotBeTrue(const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _notBeTrueFunc(location.file_name(), static_cast<int>(location.line()), because);
+    }
+
+    void NotBeFalse(const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _notBeFalseFunc(location.file_name(), static_cast<int>(location.line()), because);
+    }
+#endif
+
+private:
+    const bool m_value;
+};
+
+template <class TAssertImpl> class ThatBoolImpl
+{
+public:
+    explicit ThatBoolImpl(const bool value)
+        : m_value(value)
+    {
+    }
+
+    [[nodiscard]] bool value() const
+    {
+        return m_value;
+    }
+
+    [[nodiscard]] ShouldBoolImpl<TAssertImpl> Should() const
+    {
+        return ShouldBoolImpl<TAssertImpl>(m_value);
+    }
+
+protected:
+    const bool m_value;
+};
+
+/* String */
+///
+/// Views the subject and the expected values, so that no string assertion copies its inputs. The subject's characters
+/// are owned too when `Should()` was called on a `ThatStrImpl` holding a temporary string (TStorage is then T), so
+/// that the result can be stored before a verb is called on it
+template <class TAssertImpl, class T, typename TStorage = std::basic_string_view<typename T::value_type>> class ShouldStrImpl
+{
+public:
+    using view_type = std::basic_string_view<typename T::value_type>;
+
+    explicit ShouldStrImpl(const view_type value)
+        : m_storage(value), m_value(m_storage)
+    {
+    }
+
+    explicit ShouldStrImpl(T&& value)
+        : m_storage(std::move(value)), m_value(m_storage)
+    {
+        static_assert(std::is_same_v<TStorage, T>, "A temporary string must be owned by the ShouldStrImpl");
+    }
+
+    // The view follows the storage, which a copied or moved string no longer shares
+    ShouldStrImpl(const ShouldStrImpl& other)
+        : m_storage(other.m_storage), m_value(m_storage)
+    {
+    }
+
+    ShouldStrImpl(ShouldStrImpl&& other) noexcept
+        : m_storage(std::move(other.m_storage)), m_value(m_storage)
+    {
+    }
+
+    void _beFunc(const char* file, const int line, const view_type expected_value, const std::string_view because = {})
+    {
+        TAssertImpl::AssertStringEqual(expected_value, m_value, FailureContext(file, line, because));
+    }
+
+    void _notBeFunc(const char* file, const int line, const view_type expected_value, const std::string_view because = {})
+    {
+        TAssertImpl::template AssertNotEqual<view_type>(expected_value, m_value, FailureContext(file, line, because));
+    }
+
+    void _haveLengthFunc(const char* file, const int line, const size_t expected_length,
+        const std::string_view because = {}) const
+    {
+        TAssertImpl::AssertStringLength(expected_length, m_value, FailureContext(file, line, because));
+    }
+
+    void _notHaveLengthFunc(const char* file, const int line, const size_t expected_length,
+        const std::string_view because = {}) const
+    {
+        TAssertImpl::AssertNotStringLength(expected_length, m_value, FailureContext(file, line, because));
+    }
+
+    void _beEmptyFunc(const char* file, const int line, const std::string_view because = {}) const
+    {
+        TAssertImpl::AssertStringEmpty(m_value, FailureContext(file, line, because));
+    }
+
+    void _notBeEmptyFunc(const char* file, const int line, const std::string_view because = {}) const
+    {
+        TAssertImpl::AssertNotStringEmpty(m_value, FailureContext(file, line, because));
+    }
+
+    void _startsWithFunc(const char* file, const int line, const view_type expected_prefix,
+        const std::string_view because = {}) const
+    {
+        TAssertImpl::AssertStringStartsWith(expected_prefix, m_value, FailureContext(file, line, because));
+    }
+
+    void _endsWithFunc(const char* file, const int line, const view_type expected_suffix,
+        const std::string_view because = {}) const
+    {
+        TAssertImpl::AssertStringEndsWith(expected_suffix, m_value, FailureContext(file, line, because));
+    }
+
+    // Defined in ChamoisStrings.hpp
+    void _containFunc(const char* file, int line, view_type needle, std::string_view because = {}) const;
+    void _notContainFunc(const char* file, int line, view_type needle, std::string_view because = {}) const;
+    template <typename TNeedles>
+    void _containAllFunc(const char* file, int line, const TNeedles& needles, std::string_view because = {}) const;
+    void _containAllFunc(const char* file, int line, std::initializer_list<view_type> needles,
+        std::string_view because = {}) const;
+    template <typename TNeedles>
+    void _containInOrderFunc(const char* file, int line, const TNeedles& needles, std::string_view because = {}) const;
+    void _containInOrderFunc(const char* file, int line, std::initializer_list<view_type> needles,
+        std::string_view because = {}) const;
+    void _beEquivalentToIgnoringCaseFunc(const char* file, int line, view_type expected_value,
+        std::string_view because = {}) const;
+    void _startsWithIgnoringCaseFunc(const char* file, int line, view_type expected_prefix,
+        std::string_view because = {}) const;
+    void _containIgnoringCaseFunc(const char* file, int line, view_type needle, std::string_view because = {}) const;
+    void _matchWildcardFunc(const char* file, int line, view_type pattern, std::string_view because = {}) const;
+    void _notMatchWildcardFunc(const char* file, int line, view_type pattern, std::string_view because = {}) const;
+    void _matchWildcardIgnoringCaseFunc(
+        const char* file, int line, view_type pattern, std::string_view because = {}) const;
+
+    // Defined in ChamoisRegex.hpp
+    void _matchRegexFunc(const char* file, int line, view_type pattern, std::string_view because = {}) const;
+    void _notMatchRegexFunc(const char* file, int line, view_type pattern, std::string_view because = {}) const;
+    void _containMatchFunc(const char* file, int line, view_type pattern, std::string_view because = {}) const;
+
+#ifdef CHAMOIS_NO_MACROS
+    void Be(const view_type expected_value, const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _beFunc(location.file_name(), static_cast<int>(location.line()), expected_value, because);
+    }
+
+    void NotBe(const view_type expected_value, const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _notBeFunc(location.file_name(), static_cast<int>(location.line()), expected_value, because);
+    }
+
+    void HaveLength(const size_t expected_length, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        _haveLengthFunc(location.file_name(), static_cast<int>(location.line()), expected_length, because);
+    }
+
+    void NotHaveLength(const size_t expected_length, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        _notHaveLengthFunc(location.file_name(), static_cast<int>(location.line()), expected_length, because);
+    }
+
+    void BeEmpty(const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        _beEmptyFunc(location.file_name(), static_cast<int>(location.line()), because);
+    }
+
+    void NotBeEmpty(const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        _notBeEmptyFunc(location.file_name(), static_cast<int>(location.line()), because);
+    }
+
+    void StartWith(const view_type expected_prefix, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        _startsWithFunc(location.file_name(), static_cast<int>(location.line()), expected_prefix, because);
+    }
+
+    void EndWith(const view_type expected_suffix, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        _endsWithFunc(location.file_name(), static_cast<int>(location.line()), expected_suffix, because);
+    }
+
+    void Contain(const view_type needle, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        _containFunc(location.file_name(), static_cast<int>(location.line()), needle, because);
+    }
+
+    void NotContain(const view_type needle, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        _notContainFunc(location.file_name(), static_cast<int>(location.line()), needle, because);
+    }
+
+    template <typename TNeedles>
+    void ContainAll(const TNeedles& needles, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        _containAllFunc(location.file_name(), static_cast<int>(location.line()), needles, because);
+    }
+
+    void ContainAll(const std::initializer_list<view_type> needles, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        _containAllFunc(location.file_name(), static_cast<int>(location.line()), needles, because);
+    }
+
+    template <typename TNeedles>
+    void ContainInOrder(const TNeedles& needles, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        _containInOrderFunc(location.file_name(), static_cast<int>(location.line()), needles, because);
+    }
+
+    void ContainInOrder(const std::initializer_list<view_type> needles, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        _containInOrderFunc(location.file_name(), static_cast<int>(location.line()), needles, because);
+    }
+
+    void MatchRegex(const view_type pattern, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        _matchRegexFunc(location.file_name(), static_cast<int>(location.line()), pattern, because);
+    }
+
+    void NotMatchRegex(const view_type pattern, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        _notMatchRegexFunc(location.file_name(), static_cast<int>(location.line()), pattern, because);
+    }
+
+    void ContainMatch(const view_type pattern, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        _containMatchFunc(location.file_name(), static_cast<int>(location.line()), pattern, because);
+    }
+
+    void BeEquivalentToIgnoringCase(const view_type expected_value, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        _beEquivalentToIgnoringCaseFunc(location.file_name(), static_cast<int>(location.line()), expected_value, because);
+    }
+
+    void StartWithIgnoringCase(const view_type expected_prefix, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        _startsWithIgnoringCaseFunc(location.file_name(), static_cast<int>(location.line()), expected_prefix, because);
+    }
+
+    void ContainIgnoringCase(const view_type needle, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        _containIgnoringCaseFunc(location.file_name(), static_cast<int>(location.line()), needle, because);
+    }
+
+    void MatchWildcard(const view_type pattern, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        _matchWildcardFunc(location.file_name(), static_cast<int>(location.line()), pattern, because);
+    }
+
+    void NotMatchWildcard(const view_type pattern, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        _notMatchWildcardFunc(location.file_name(), static_cast<int>(location.line()), pattern, because);
+    }
+
+    void MatchWildcardIgnoringCase(const view_type pattern, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        _matchWildcardIgnoringCaseFunc(location.file_name(), static_cast<int>(location.line()), pattern, because);
+    }
+#endif
+
+private:
+    TStorage m_storage;
+    const view_type m_value;
+};
+
+///
+/// Only owns its subject when it was handed a temporary string (TStorage is then T), otherwise it views the caller's characters
+template <class TAssertImpl, class T, typename TStorage = std::basic_string_view<typename T::value_type>> class ThatStrImpl
+{
+public:
+    using view_type = typename ShouldStrImpl<TAssertImpl, T>::view_type;
+
+    explicit ThatStrImpl(const view_type value)
+        : m_value(value)
+    {
+    }
+
+    explicit ThatStrImpl(T&& value)
+        : m_value(std::move(value))
+    {
+        static_assert(std::is_same_v<TStorage, T>, "A temporary string must be owned by the ThatStrImpl");
+    }
+
+    [[nodiscard]] view_type value() const
+    {
+        return view_type(m_value);
+    }
+
+    ShouldStrImpl<TAssertImpl, T> Should() &
+    {
+        return ShouldStrImpl<TAssertImpl, T>(value());
+    }
+
+    // A temporary subject hands its string on, as the ShouldStrImpl may outlive it
+    ShouldStrImpl<TAssertImpl, T, TStorage> Should() &&
+    {
+        if constexpr (std::is_same_v<TStorage, T>)
+        {
+            return ShouldStrImpl<TAssertImpl, T, TStorage>(std::move(m_value));
+        }
+        else
+        {
+            return ShouldStrImpl<TAssertImpl, T>(value());
+        }
+    }
+
+protected:
+    TStorage m_value;
+};
+
+/* Pointer */
+template <class TAssertImpl> class ShouldPtrImpl
+{
+public:
+    explicit ShouldPtrImpl(const void* value)
+        : m_value(value)
+    {
+    }
+
+    void _beFunc(const char* file, const int line, const void* expected_value, const std::string_view because = {})
+    {
+        TAssertImpl::AssertEqual(expected_value, m_value, FailureContext(file, line, because));
+    }
+
+    void _notBeFunc(const char* file, const int line, const void* expected_value,
+        const std::string_view because = {}) const
+    {
+        TAssertImpl::AssertNotEqual(expected_value, m_value, FailureContext(file, line, because));
+    }
+
+    void _beNullFunc(const char* file, const int line, const std::string_view because = {}) const
+    {
+        TAssertImpl::AssertEqual((void*)nullptr, m_value, FailureContext(file, line, because));
+    }
+
+    void _notBeNullFunc(const char* file, const int line, const std::string_view because = {}) const
+    {
+        TAssertImpl::AssertNotEqual((void*)nullptr, m_value, FailureContext(file, line, because));
+    }
+
+#ifdef CHAMOIS_NO_MACROS
+    void Be(const void* expected_value, const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _beFunc(location.file_name(), static_cast<int>(location.line()), expected_value, because);
+    }
+
+    void NotBe(const void* expected_value, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        _notBeFunc(location.file_name(), static_cast<int>(location.line()), expected_value, because);
+    }
+
+    void BeNull(const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        _beNullFunc(location.file_name(), static_cast<int>(location.line()), because);
+    }
+
+    void NotBeNull(const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        _notBeNullFunc(location.file_name(), static_cast<int>(location.line()), because);
+    }
+#endif
+
+private:
+    const void* m_value;
+};
+
+template <class TAssertImpl> class ThatPtrImpl
+{
+public:
+    explicit ThatPtrImpl(const void* value) : m_value(value)
+    {
+    }
+
+    ShouldPtrImpl<TAssertImpl> Should()
+    {
+        return ShouldPtrImpl<TAssertImpl>(m_value);
+    }
+
+protected:
+    const void* m_value;
+};
+
+/* Array */
+template <class TAssertImpl, typename T, int N> class ShouldArrImpl
+{
+public:
+    explicit ShouldArrImpl(const T(&value)[N])
+        : length_(N), m_value(value)
+    {
+    }
+
+    template <int O>
+    void _beFunc(const char* file, const int line, const T(&expected_value)[O], const std::string_view because = {})
+    {
+        TAssertImpl::AssertArrayEqual(expected_value, O, m_value, length_,
+            FailureContext(file, line, because));
+    }
+
+    template <int O>
+    void _notBeFunc(const char* file, const int line, const T(&expected_value)[O], const std::string_view because = {})
+    {
+        TAssertImpl::template AssertArrayNotEqual<T>(expected_value, O, m_value, length_,
+            FailureContext(file, line, because));
+    }
+
+    void _haveLengthFunc(const char* file, const int line, const size_t expected_length,
+        const std::string_view because = {}) const
+    {
+        TAssertImpl::AssertEqual(expected_length, length_, FailureContext(file, line, because));
+    }
+
+    void _notHaveLengthFunc(const char* file, const int line, const size_t expected_length,
+        const std::string_view because = {}) const
+    {
+        TAssertImpl::AssertNotEqual(expected_length, length_, FailureContext(file, line, because));
+    }
+
+#ifdef CHAMOIS_NO_MACROS
+    template <int O>
+    void Be(const T(&expected_value)[O], const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _beFunc(location.file_name(), static_cast<int>(location.line()), expected_value, because);
+    }
+
+    template <int O>
+    void NotBe(const T(&expected_value)[O], const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _notBeFunc(location.file_name(), static_cast<int>(location.line()), expected_value, because);
+    }
+
+    void HaveLength(const size_t expected_length, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        _haveLengthFunc(location.file_name(), static_cast<int>(location.line()), expected_length, because);
+    }
+
+    void NotHaveLength(const size_t expected_length, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        _notHaveLengthFunc(location.file_name(), static_cast<int>(location.line()), expected_length, because);
+    }
+#endif
+
+private:
+    const size_t length_;
+    const T(&m_value)[N];
+};
+
+template <class TAssertImpl, typename T, int N> class ThatArrImpl
+{
+public:
+    explicit ThatArrImpl(const T(&value)[N])
+        : m_value(value)
+    {
+        length_ = N;
+    }
+
+    const T* value() const
+    {
+        return &m_value;
+    }
+
+    [[nodiscard]] size_t length() const
+    {
+        return length_;
+    }
+
+    ShouldArrImpl<TAssertImpl, T, N> Should()
+    {
+        return ShouldArrImpl<TAssertImpl, T, N>(m_value);
+    }
+
+protected:
+    const T(&m_value)[N];
+    size_t length_;
+};
+
+/* Opt-in subjects, see ChamoisContainers.hpp, ChamoisRanges.hpp and ChamoisExceptions.hpp */
+template <class TAssertImpl, typename Container> class ThatContainerImpl;
+template <class TAssertImpl, typename TView> class ThatRangeImpl;
+template <class TAssertImpl> class ThatFileImpl;
+template <class TAssertImpl, typename FUNCTOR> class ExceptionImpl;
+
+/* Compile time */
+// Deliberately not constexpr: a failing Assert::Static verb calls this, which stops the constant evaluation,
+// and the compiler diagnostic then shows the file, line, reason and because of the failed verb.
+inline bool StaticAssertionFailed(const char* /*file*/, const int /*line*/, const std::string_view /*reason*/,
+    const std::string_view /*because*/)
+{
+    return false;
+}
+
+constexpr bool StaticCheck(const bool condition, const char* file, const int line, const std::string_view reason,
+    const std::string_view because)
+{
+    return condition || StaticAssertionFailed(file, line, reason, because);
+}
+
+template <typename T> class StaticShouldImpl
+{
+public:
+    constexpr explicit StaticShouldImpl(const T& value)
+        : m_value(value)
+    {
+    }
+
+    [[nodiscard]] constexpr bool _beFunc(const char* file, const int line, const T& expected_value,
+        const std::string_view because = {}) const
+    {
+        return StaticCheck(m_value == expected_value, file, line, "values are not equal", because);
+    }
+
+    [[nodiscard]] constexpr bool _notBeFunc(const char* file, const int line, const T& expected_value,
+        const std::string_view because = {}) const
+    {
+        return StaticCheck(!(m_value == expected_value), file, line, "values are equal", because);
+    }
+
+    [[nodiscard]] constexpr bool _beZeroFunc(const char* file, const int line, const T& /*expected_value*/,
+        const std::string_view because = {}) const
+    {
+        return StaticCheck(m_value == T{}, file, line, "value is not zero", because);
+    }
+
+    [[nodiscard]] constexpr bool _notBeZeroFunc(const char* file, const int line, const T& /*expected_value*/,
+        const std::string_view because = {}) const
+    {
+        return StaticCheck(!(m_value == T{}), file, line, "value is zero", because);
+    }
+
+    [[nodiscard]] constexpr bool _bePositiveFunc(const char* file, const int line, const T& /*expected_value*/,
+        const std::string_view because = {}) const
+    {
+        return StaticCheck(T{} <= m_value, file, line, "value is negative", because);
+    }
+
+    [[nodiscard]] constexpr bool _beNegativeFunc(const char* file, const int line, const T& /*expected_value*/,
+        const std::string_view because = {}) const
+    {
+        return StaticCheck(m_value < T{}, file, line, "value is not negative", because);
+    }
+
+    [[nodiscard]] constexpr bool _beGreaterThanFunc(const char* file, const int line, const T& expected_value,
+        const std::string_view because = {}) const
+    {
+        return StaticCheck(expected_value < m_value, file, line, "value is not greater", because);
+    }
+
+    [[nodiscard]] constexpr bool _beGreaterThanOrEqualFunc(const char* file, const int line, const T& expected_value,
+        const std::string_view because = {}) const
+    {
+        return StaticCheck(expected_value <= m_value, file, line, "value is less", because);
+    }
+
+    [[nodiscard]] constexpr bool _beLessThanFunc(const char* file, const int line, const T& expected_value,
+        const std::string_view because = {}) const
+    {
+        return StaticCheck(m_value < expected_value, file, line, "value is not less", because);
+    }
+
+    [[nodiscard]] constexpr bool _beLessThanOrEqualFunc(const char* file, const int line, const T& expected_value,
+        const std::string_view because = {}) const
+    {
+        return StaticCheck(m_value <= expected_value, file, line, "value is greater", because);
+    }
+
+    [[nodiscard]] constexpr bool _beInRangeFunc(const char* file, const int line, const T& min_value,
+        const T& max_value, const std::string_view because = {}) const
+    {
+        return StaticCheck(min_value <= m_value && m_value <= max_value, file, line, "value is out of range",
+            because);
+    }
+
+    [[nodiscard]] constexpr bool _notBeInRangeFunc(const char* file, const int line, const T& min_value,
+        const T& max_value, const std::string_view because = {}) const
+    {
+        return StaticCheck(min_value > m_value || m_value > max_value, file, line, "value is in range", because);
+    }
+
+    [[nodiscard]] constexpr bool _beApproximatelyFunc(const char* file, const int line, const T& expected_value,
+        const T& tolerance, const std::string_view because = {}) const
+    {
+        const T difference = m_value < expected_value ? expected_value - m_value : m_value - expected_value;
+        return StaticCheck(difference <= tolerance, file, line, "value is not within tolerance", because);
+    }
+
+    [[nodiscard]] constexpr bool _beTrueFunc(const char* file, const int line,
+        const std::string_view because = {}) const
+    {
+        return StaticCheck(m_value == true, file, line, "value is false", because);
+    }
+
+    [[nodiscard]] constexpr bool _beFalseFunc(const char* file, const int line,
+        const std::string_view because = {}) const
+    {
+        return StaticCheck(m_value == false, file, line, "value is true", because);
+    }
+
+    [[nodiscard]] constexpr bool _notBeTrueFunc(const char* file, const int line,
+        const std::string_view because = {}) const
+    {
+        return _beFalseFunc(file, line, because);
+    }
+
+    [[nodiscard]] constexpr bool _notBeFalseFunc(const char* file, const int line,
+        const std::string_view because = {}) const
+    {
+        return _beTrueFunc(file, line, because);
+    }
+
+#ifdef CHAMOIS_NO_MACROS
+    [[nodiscard]] constexpr bool Be(const T& expected_value, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        return _beFunc(location.file_name(), static_cast<int>(location.line()), expected_value, because);
+    }
+
+    [[nodiscard]] constexpr bool NotBe(const T& expected_value, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        return _notBeFunc(location.file_name(), static_cast<int>(location.line()), expected_value, because);
+    }
+
+    [[nodiscard]] constexpr bool BeZero(const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        return _beZeroFunc(location.file_name(), static_cast<int>(location.line()), T{}, because);
+    }
+
+    [[nodiscard]] constexpr bool NotBeZero(const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        return _notBeZeroFunc(location.file_name(), static_cast<int>(location.line()), T{}, because);
+    }
+
+    [[nodiscard]] constexpr bool BePositive(const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        return _bePositiveFunc(location.file_name(), static_cast<int>(location.line()), T{}, because);
+    }
+
+    [[nodiscard]] constexpr bool BeNegative(const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        return _beNegativeFunc(location.file_name(), static_cast<int>(location.line()), T{}, because);
+    }
+
+    [[nodiscard]] constexpr bool BeGreaterThan(const T& expected_value, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        return _beGreaterThanFunc(location.file_name(), static_cast<int>(location.line()), expected_value, because);
+    }
+
+    [[nodiscard]] constexpr bool BeGreaterThanOrEqual(const T& expected_value, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        return _beGreaterThanOrEqualFunc(location.file_name(), static_cast<int>(location.line()), expected_value,
+            because);
+    }
+
+    [[nodiscard]] constexpr bool BeLessThan(const T& expected_value, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        return _beLessThanFunc(location.file_name(), static_cast<int>(location.line()), expected_value, because);
+    }
+
+    [[nodiscard]] constexpr bool BeLessThanOrEqual(const T& expected_value, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        return _beLessThanOrEqualFunc(location.file_name(), static_cast<int>(location.line()), expected_value,
+            because);
+    }
+
+    [[nodiscard]] constexpr bool BeInRange(const T& min_value, const T& max_value, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        return _beInRangeFunc(location.file_name(), static_cast<int>(location.line()), min_value, max_value, because);
+    }
+
+    [[nodiscard]] constexpr bool NotBeInRange(const T& min_value, const T& max_value,
+        const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        return _notBeInRangeFunc(location.file_name(), static_cast<int>(location.line()), min_value, max_value,
+            because);
+    }
+
+    [[nodiscard]] constexpr bool BeApproximately(const T& expected_value, const T& tolerance,
+        const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        return _beApproximatelyFunc(location.file_name(), static_cast<int>(location.line()), expected_value,
+            tolerance, because);
+    }
+
+    [[nodiscard]] constexpr bool BeTrue(const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        return _beTrueFunc(location.file_name(), static_cast<int>(location.line()), because);
+    }
+
+    [[nodiscard]] constexpr bool BeFalse(const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        return _beFalseFunc(location.file_name(), static_cast<int>(location.line()), because);
+    }
+
+    [[nodiscard]] constexpr bool NotBeTrue(const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        return _notBeTrueFunc(location.file_name(), static_cast<int>(location.line()), because);
+    }
+
+    [[nodiscard]] constexpr bool NotBeFalse(const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        return _notBeFalseFunc(location.file_name(), static_cast<int>(location.line()), because);
+    }
+#endif
+
+private:
+    SubjectRef<T> m_value;
+};
+
+template <typename CharT> class StaticShouldStrImpl
+{
+public:
+    using view_type = std::basic_string_view<CharT>;
+
+    constexpr explicit StaticShouldStrImpl(const view_type value)
+        : m_value(value)
+    {
+    }
+
+    [[nodiscard]] constexpr bool _beFunc(const char* file, const int line, const view_type expected_value,
+        const std::string_view because = {}) const
+    {
+        return StaticCheck(m_value == expected_value, file, line, "strings are not equal", because);
+    }
+
+    [[nodiscard]] constexpr bool _notBeFunc(const char* file, const int line, const view_type expected_value,
+        const std::string_view because = {}) const
+    {
+        return StaticCheck(m_value != expected_value, file, line, "strings are equal", because);
+    }
+
+    [[nodiscard]] constexpr bool _haveLengthFunc(const char* file, const int line, const size_t expected_length,
+        const std::string_view because = {}) const
+    {
+        return StaticCheck(m_value.length() == expected_length, file, line, "string length differs", because);
+    }
+
+    [[nodiscard]] constexpr bool _notHaveLengthFunc(const char* file, const int line, const size_t expected_length,
+        const std::string_view because = {}) const
+    {
+        return StaticCheck(m_value.length() != expected_length, file, line, "string length is the same", because);
+    }
+
+    [[nodiscard]] constexpr bool _beEmptyFunc(const char* file, const int line,
+        const std::string_view because = {}) const
+    {
+        return StaticCheck(m_value.empty(), file, line, "string is not empty", because);
+    }
+
+    [[nodiscard]] constexpr bool _notBeEmptyFunc(const char* file, const int line,
+        const std::string_view because = {}) const
+    {
+        return StaticCheck(!m_value.empty(), file, line, "string is empty", because);
+    }
+
+    [[nodiscard]] constexpr bool _startsWithFunc(const char* file, const int line, const view_type expected_value,
+        const std::string_view because = {}) const
+    {
+        return StaticCheck(m_value.substr(0, expected_value.length()) == expected_value, file, line,
+            "string does not start with the expected value", because);
+    }
+
+#ifdef CHAMOIS_NO_MACROS
+    [[nodiscard]] constexpr bool Be(const view_type expected_value, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        return _beFunc(location.file_name(), static_cast<int>(location.line()), expected_value, because);
+    }
+
+    [[nodiscard]] constexpr bool NotBe(const view_type expected_value, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        return _notBeFunc(location.file_name(), static_cast<int>(location.line()), expected_value, because);
+    }
+
+    [[nodiscard]] constexpr bool HaveLength(const size_t expected_length, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        return _haveLengthFunc(location.file_name(), static_cast<int>(location.line()), expected_length, because);
+    }
+
+    [[nodiscard]] constexpr bool NotHaveLength(const size_t expected_length, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        return _notHaveLengthFunc(location.file_name(), static_cast<int>(location.line()), expected_length, because);
+    }
+
+    [[nodiscard]] constexpr bool BeEmpty(const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        return _beEmptyFunc(location.file_name(), static_cast<int>(location.line()), because);
+    }
+
+    [[nodiscard]] constexpr bool NotBeEmpty(const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        return _notBeEmptyFunc(location.file_name(), static_cast<int>(location.line()), because);
+    }
+
+    [[nodiscard]] constexpr bool StartWith(const view_type expected_value, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        return _startsWithFunc(location.file_name(), static_cast<int>(location.line()), expected_value, because);
+    }
+#endif
+
+private:
+    const view_type m_value;
+};
+
+template <typename T, int N> class StaticShouldArrImpl
+{
+public:
+    constexpr explicit StaticShouldArrImpl(const T(&value)[N])
+        : m_value(value)
+    {
+    }
+
+    template <int O>
+    [[nodiscard]] constexpr bool _beFunc(const char* file, const int line, const T(&expected_value)[O],
+        const std::string_view because = {}) const
+    {
+        return StaticCheck(Equal(expected_value), file, line, "arrays are not equal", because);
+    }
+
+    template <int O>
+    [[nodiscard]] constexpr bool _notBeFunc(const char* file, const int line, const T(&expected_value)[O],
+        const std::string_view because = {}) const
+    {
+        return StaticCheck(!Equal(expected_value), file, line, "arrays are equal", because);
+    }
+
+    [[nodiscard]] constexpr bool _haveLengthFunc(const char* file, const int line, const size_t expected_length,
+        const std::string_view because = {}) const
+    {
+        return StaticCheck(N == expected_length, file, line, "array length differs", because);
+    }
+
+    [[nodiscard]] constexpr bool _notHaveLengthFunc(const char* file, const int line, const size_t expected_length,
+        const std::string_view because = {}) const
+    {
+        return StaticCheck(N != expected_length, file, line, "array length is the same", because);
+    }
+
+#ifdef CHAMOIS_NO_MACROS
+    template <int O>
+    [[nodiscard]] constexpr bool Be(const T(&expected_value)[O], const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        return _beFunc(location.file_name(), static_cast<int>(location.line()), expected_value, because);
+    }
+
+    template <int O>
+    [[nodiscard]] constexpr bool NotBe(const T(&expected_value)[O], const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        return _notBeFunc(location.file_name(), static_cast<int>(location.line()), expected_value, because);
+    }
+
+    [[nodiscard]] constexpr bool HaveLength(const size_t expected_length, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        return _haveLengthFunc(location.file_name(), static_cast<int>(location.line()), expected_length, because);
+    }
+
+    [[nodiscard]] constexpr bool NotHaveLength(const size_t expected_length, const std::string_view because = {},
+        const std::source_location location = std::source_location::current()) const
+    {
+        return _notHaveLengthFunc(location.file_name(), static_cast<int>(location.line()), expected_length, because);
+    }
+#endif
+
+private:
+    template <int O> [[nodiscard]] constexpr bool Equal(const T(&expected_value)[O]) const
+    {
+        if (O != N)
+        {
+            return false;
+        }
+        for (int i = 0; i < N; ++i)
+        {
+            if (!(m_value[i] == expected_value[i]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    const T(&m_value)[N];
+};
+
+template <class TShould, typename TValue> class StaticThatImpl
+{
+public:
+    constexpr explicit StaticThatImpl(TValue value)
+        : m_value(value)
+    {
+    }
+
+    [[nodiscard]] constexpr TValue value() const
+    {
+        return m_value;
+    }
+
+    [[nodiscard]] constexpr TShould Should() const
+    {
+        return TShould(m_value);
+    }
+
+private:
+    TValue m_value;
+};
+
+///
+/// Assert::Static evaluates the same verbs during constant evaluation, each returning true, so that they can be
+/// checked with static_assert. A failing verb is not a constant expression and so fails the compilation.
+class StaticAssert
+{
+public:
+    template <typename T> static constexpr StaticThatImpl<StaticShouldImpl<T>, SubjectRef<T>> That(const T& value)
+    {
+        return StaticThatImpl<StaticShouldImpl<T>, SubjectRef<T>>(value);
+    }
+
+    static constexpr StaticThatImpl<StaticShouldStrImpl<char>, std::string_view> That(const std::string_view value)
+    {
+        return StaticThatImpl<StaticShouldStrImpl<char>, std::string_view>(value);
+    }
+
+    static constexpr StaticThatImpl<StaticShouldStrImpl<wchar_t>, std::wstring_view> That(
+        const std::wstring_view value)
+    {
+        return StaticThatImpl<StaticShouldStrImpl<wchar_t>, std::wstring_view>(value);
+    }
+
+    static constexpr StaticThatImpl<StaticShouldStrImpl<char>, std::string_view> That(const char* value)
+    {
+        return That(std::string_view(value));
+    }
+
+    static constexpr StaticThatImpl<StaticShouldStrImpl<wchar_t>, std::wstring_view> That(const wchar_t* value)
+    {
+        return That(std::wstring_view(value));
+    }
+
+    template <typename T, int N>
+    static constexpr StaticThatImpl<StaticShouldArrImpl<T, N>, const T(&)[N]> ThatArray(const T(&value)[N])
+    {
+        return StaticThatImpl<StaticShouldArrImpl<T, N>, const T(&)[N]>(value);
+    }
+};
+}    // namespace detail
+
+template <class TAssertImpl> class BasicAssert
+{
+public:
+    using Static = detail::StaticAssert;
+
+    static void Message(const std::string& value)
+    {
+        //detail::MessageImpl( value);
+        std::fprintf(stderr, "[ Message  ] %s\n", value.c_str());
+    }
+
+    /* Default */
+    template <typename T> static detail::ThatImpl<TAssertImpl, T> That(const T& value)
+    {
+        return detail::ThatImpl<TAssertImpl, T>(value);
+    }
+
+    template <typename T, std::enable_if_t<detail::IsOwnedSubject<T>, int> = 0>
+    static detail::ThatImpl<TAssertImpl, T, T> That(T&& value)
+    {
+        return detail::ThatImpl<TAssertImpl, T, T>(std::move(value));
+    }
+
+    /* Numeric */
+    static detail::ThatNumImpl<TAssertImpl, std::int8_t> That(const std::int8_t value)
+    {
+        return detail::ThatNumImpl<TAssertImpl, std::int8_t>(value);
+    }
+    static detail::ThatNumImpl<TAssertImpl, std::uint8_t> That(const std::uint8_t value)
+    {
+        return detail::ThatNumImpl<TAssertImpl, std::uint8_t>(value);
+    }
+
+    static detail::ThatNumImpl<TAssertImpl, std::int16_t> That(const std::int16_t value)
+    {
+        return detail::ThatNumImpl<TAssertImpl, std::int16_t>(value);
+    }
+
+    static detail::ThatNumImpl<TAssertImpl, std::uint16_t> That(const std::uint16_t value)
+    {
+        return detail::ThatNumImpl<TAssertImpl, std::uint16_t>(value);
+    }
+
+    static detail::ThatNumImpl<TAssertImpl, std::int32_t> That(const std::int32_t value)
+    {
+        return detail::ThatNumImpl<TAssertImpl, std::int32_t>(value);
+    }
+
+    static detail::ThatNumImpl<TAssertImpl, std::uint32_t> That(const std::uint32_t value)
+    {
+        return detail::ThatNumImpl<TAssertImpl, std::uint32_t>(value);
+    }
+
+    static detail::ThatNumImpl<TAssertImpl, long> That(const long value)
+    {
+        return detail::ThatNumImpl<TAssertImpl, long>(value);
+    }
+
+    static detail::ThatNumImpl<TAssertImpl, unsigned long> That(const unsigned long value)
+    {
+        return detail::ThatNumImpl<TAssertImpl, unsigned long>(value);
+    }
+
+    // Spelt as long long rather than std::int64_t, which is `long` on LP64 platforms and would redeclare the above
+    static detail::ThatNumImpl<TAssertImpl, long long> That(const long long value)
+    {
+        return detail::ThatNumImpl<TAssertImpl, long long>(value);
+    }
+    static detail::ThatNumImpl<TAssertImpl, unsigned long long> That(const unsigned long long value)
+    {
+        return detail::ThatNumImpl<TAssertImpl, unsigned long long>(value);
+    }
+
+    static detail::ThatNumImpl<TAssertImpl, float> That(const float value)
+    {
+        return detail::ThatNumImpl<TAssertImpl, float>(value);
+    }
+
+    static detail::ThatNumImpl<TAssertImpl, double> That(const double value)
+    {
+        return detail::ThatNumImpl<TAssertImpl, double>(value);
+    }
+
+    /* Boolean */
+    static detail::ThatBoolImpl<TAssertImpl> That(const bool value)
+    {
+        return detail::ThatBoolImpl<TAssertImpl>(value);
+    }
+
+    /* Array */
+    template <typename T, int N> static detail::ThatArrImpl<TAssertImpl, T, N> ThatArray(const T(&value)[N])
+    {
+        return detail::ThatArrImpl<TAssertImpl, T, N>(value);
+    }
+
+    /* String */
+    // Lvalue strings, views and character pointers are viewed in place; only temporaries are moved into the subject
+    static detail::ThatStrImpl<TAssertImpl, std::wstring> That(const std::wstring& value)
+    {
+        return detail::ThatStrImpl<TAssertImpl, std::wstring>(std::wstring_view(value));
+    }
+
+    static detail::ThatStrImpl<TAssertImpl, std::wstring, std::wstring> That(std::wstring&& value)
+    {
+        return detail::ThatStrImpl<TAssertImpl, std::wstring, std::wstring>(std::move(value));
+    }
+
+    static detail::ThatStrImpl<TAssertImpl, std::string> That(const std::string& value)
+    {
+        return detail::ThatStrImpl<TAssertImpl, std::string>(std::string_view(value));
+    }
+
+    static detail::ThatStrImpl<TAssertImpl, std::string, std::string> That(std::string&& value)
+    {
+        return detail::ThatStrImpl<TAssertImpl, std::string, std::string>(std::move(value));
+    }
+
+    static detail::ThatStrImpl<TAssertImpl, std::wstring> That(const std::wstring_view value)
+    {
+        return detail::ThatStrImpl<TAssertImpl, std::wstring>(value);
+    }
+
+    static detail::ThatStrImpl<TAssertImpl, std::string> That(const std::string_view value)
+    {
+        return detail::ThatStrImpl<TAssertImpl, std::string>(value);
+    }
+
+    static detail::ThatStrImpl<TAssertImpl, std::wstring> That(const wchar_t* value)
+    {
+        return That(std::wstring_view(value));
+    }
+
+    static detail::ThatStrImpl<TAssertImpl, std::string> That(const char* value)
+    {
+        return That(std::string_view(value));
+    }
+
+    /* Pointer */
+
+    static detail::ThatPtrImpl<TAssertImpl> ThatPtr(const void* value)
+    {
+        return detail::ThatPtrImpl<TAssertImpl>(value);
+    }
+
+    template <typename T> static detail::ThatPtrImpl<TAssertImpl> ThatPtr(const std::unique_ptr<T>& value)
+    {
+        return detail::ThatPtrImpl<TAssertImpl>(value.get());
+    }
+
+    template <typename T> static detail::ThatPtrImpl<TAssertImpl> ThatPtr(const std::shared_ptr<T>& value)
+    {
+        return detail::ThatPtrImpl<TAssertImpl>(value.get());
+    }
+
+    // Defined in ChamoisContainers.hpp
+    template <typename T> static detail::ThatContainerImpl<TAssertImpl, T> ThatContainer(const T& container);
+
+    // Defined in ChamoisRanges.hpp
+    template <typename TRange> static auto ThatRange(TRange&& range);
+    template <typename TIterator, typename TSentinel> static auto ThatRange(TIterator first, TSentinel last);
+
+    // Defined in ChamoisFiles.hpp
+    template <typename TPath> static detail::ThatFileImpl<TAssertImpl> ThatFile(const TPath& path);
+
+
+    /* Char Array */
+    /*
+    template<int N>
+    static detail::ThatPtrImpl<char> That(const char (&value)[N])
+    {
+        return detail::ThatPtrImpl<char>(var, value);
+    }
+
+    template<int N>
+    static detail::ThatPtrImpl<char> That(const char (&value)[N])
+    {
+        return detail::ThatPtrImpl<char>(var, value);
+    }
+    */
+
+
+    /* cannot do the following due to:  // NOLINT(clang-diagnostic-invalid-utf8)
+     * The type-of a lambda expression in C++ is an unnamed closure type.
+     * The closure type is generated by the compiler based on the structure and behavior of the lambda expression.
+     * Or, put another way:
+     * The type-of a lambda is implementation defined, meaning that from C++ it doesn't actually have a type.
+     *
+    static detail::ExceptionImpl<void()> That(std::function<void()> func)
+    {
+        auto var = TAssertImpl();
+        return detail::ExceptionImpl(var, func);
+    }
+    */
+
+    // Defined in ChamoisExceptions.hpp
+    static detail::ExceptionImpl<TAssertImpl, void (*)()> That(void (*func)() );
+
+    template<typename FUNCTOR>
+    static detail::ExceptionImpl<TAssertImpl, FUNCTOR> ThatLambda(FUNCTOR func);
+
+};
+
+using Assert = BasicAssert<detail::AssertInternal>;
+}    //namespace evolutional
@@ -0,0 +1,503 @@
+#pragma once
+
+/*
+ *    Copyright 2014 Oli Wilkinson
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *        distributed under the License is distributed on an "AS IS" BASIS,
+ *        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *        See the License for the specific language governing permissions and
+ *        limitations under the License.
+ *
+ *    Then modified by Smurf-IV from 2022-12-12 onwards
+ *    https://github.com/Smurf-IV/FluentAssertions-for-Cpp/commits/master
+ *    Current date is 2023-06-14
+ */
+
+// The edit script diff shown when two containers or ranges differ; included by ChamoisContainers.hpp and ChamoisRanges.hpp.
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ChamoisCore.hpp"
+#include "ChamoisEquivalence.hpp"
+
+#ifndef CHAMOIS_DIFF_LINE_LIMIT
+/// How many lines of diff a failed container or range comparison shows
+#define CHAMOIS_DIFF_LINE_LIMIT 20
+#endif
+
+namespace evolutional
+{
+namespace detail
+{
+///
+/// Failure path only: the elements to remove from `expected` and add from `actual` to turn one into the other.
+/// Myers' O((N+M)D) algorithm, in linear space; a long pair of sequences of hashable elements is first split at the
+/// elements that are there exactly once on each side (patience diff).
+/// The search is bounded in depth and in comparisons, so huge and very different inputs still fail quickly: past the
+/// bounds, what is left is reported as one change and the script is no longer the shortest.
+/// `expected(i)` and `actual(j)` give the elements by index, by reference; the indices shown start at `offset`.
+template <typename T, typename TExpected, typename TActual> class Diff
+{
+public:
+    /// `removed` elements of expected at `expected`, replaced by `added` elements of actual at `actual`
+    struct Change
+    {
+        size_t expected;
+        size_t actual;
+        size_t removed;
+        size_t added;
+    };
+
+    Diff(const size_t expected_size, const size_t actual_size, TExpected expected, TActual actual,
+        const size_t offset = 0)
+        : m_expected_size(expected_size), m_actual_size(actual_size), m_expected(std::move(expected)),
+        m_actual(std::move(actual)), m_offset(offset)
+    {
+        Compare(0, expected_size, 0, actual_size);
+    }
+
+    [[nodiscard]] const std::vector<Change>& Changes() const noexcept
+    {
+        return m_changes;
+    }
+
+    /// The number of elements removed plus the number added
+    [[nodiscard]] size_t Edits() const noexcept
+    {
+        size_t edits = 0;
+        for (const Change& change : m_changes)
+        {
+            edits += change.removed + change.added;
+        }
+        return edits;
+    }
+
+    /// False when a bound was reached, and the script may be longer than it needs to be
+    [[nodiscard]] bool Shortest() const noexcept
+    {
+        return !m_capped;
+    }
+
+    /// Unified diff style hunks, with two elements of context and 0 based indices, up to CHAMOIS_DIFF_LINE_LIMIT lines:
+    ///     @@ -0,3 +0,4 @@
+    ///     + 42
+    ///       1
+    ///       2
+    template <typename TFormat> [[nodiscard]] std::string Text(const TFormat format) const
+    {
+        std::string text;
+        size_t lines = 0;
+        size_t unshown = 0;
+        for (size_t first = 0; first < m_changes.size();)
+        {
+            // Changes closer together than twice the context share a hunk
+            size_t last = first;
+            while (last + 1 < m_changes.size() &&
+                m_changes[last + 1].expected - (m_changes[last].expected + m_changes[last].removed) <= 2 * Context)
+            {
+                ++last;
+            }
+            if (lines >= CHAMOIS_DIFF_LINE_LIMIT)
+            {
+                for (; first <= last; ++first)
+                {
+                    unshown += m_changes[first].removed + m_changes[first].added;
+                }
+                continue;
+            }
+            const size_t before = m_changes[first].expected < Context ? m_changes[first].expected : Context;
+            const size_t expected_begin = m_changes[first].expected - before;
+            const size_t actual_begin = m_changes[first].actual - before;
+            const size_t after = Following(m_changes[last]);
+            const size_t expected_end = m_changes[last].expected + m_changes[last].removed + after;
+            const size_t actual_end = m_changes[last].actual + m_changes[last].added + after;
+            text.append(text.empty() ? "" : "\n").append("@@ -").append(std::to_string(m_offset + expected_begin));
+            text.append(",").append(std::to_string(expected_end - expected_begin)).append(" +");
+            text.append(std::to_string(m_offset + actual_begin)).append(",");
+            text.append(std::to_string(actual_end - actual_begin)).append(" @@");
+            size_t expected_at = expected_begin;
+            const auto line = [&](const char* prefix, const T& element) {
+                if (lines < CHAMOIS_DIFF_LINE_LIMIT)
+                {
+                    text.append("\n").append(prefix).append(format(element));
+                    ++lines;
+                    return true;
+                }
+                return false;
+            };
+            for (size_t index = first; index <= last; ++index)
+            {
+                const Change& change = m_changes[index];
+                for (; expected_at < change.expected; ++expected_at)
+                {
+                    (void)line("  ", m_expected(expected_at));
+                }
+                for (size_t removed = 0; removed < change.removed; ++removed)
+                {
+                    unshown += line("- ", m_expected(change.expected + removed)) ? 0 : 1;
+                }
+                for (size_t added = 0; added < change.added; ++added)
+                {
+                    unshown += line("+ ", m_actual(change.actual + added)) ? 0 : 1;
+                }
+                expected_at = change.expected + change.removed;
+            }
+            for (; expected_at < expected_end; ++expected_at)
+            {
+                (void)line("  ", m_expected(expected_at));
+            }
+            first = last + 1;
+        }
+        if (unshown > 0)
+        {
+            text.append("\n... (").append(std::to_string(unshown)).append(" more changed elements)");
+        }
+        return text;
+    }
+
+private:
+    static constexpr size_t Context = 2;
+    // Patience diff is only worth its hash table on sequences at least this long, and takes too long on longer ones
+    static constexpr size_t PatienceLength = 1024;
+    static constexpr size_t MaxPatienceLength = size_t{ 1 } << 22;
+    // How far the search for the middle of a shortest script goes, in edits, before giving up on a part
+    static constexpr size_t MaxDepth = 2048;
+    // The comparisons per element Myers gets before patience diff is tried instead, at most half of what is left
+    static constexpr size_t TrialComparisons = 16;
+
+    bool Equal(const size_t expected, const size_t actual)
+    {
+        --m_budget;
+        return m_expected(expected) == m_actual(actual);
+    }
+
+    // The equal elements after a change, up to the context, that are there on both sides
+    size_t Following(const Change& change) const
+    {
+        const size_t expected_left = m_expected_size - (change.expected + change.removed);
+        const size_t actual_left = m_actual_size - (change.actual + change.added);
+        const size_t left = expected_left < actual_left ? expected_left : actual_left;
+        return left < Context ? left : Context;
+    }
+
+    void Add(const size_t expected, const size_t actual, const size_t removed, const size_t added)
+    {
+        if (removed == 0 && added == 0)
+        {
+            return;
+        }
+        if (!m_changes.empty() && m_changes.back().expected + m_changes.back().removed == expected &&
+            m_changes.back().actual + m_changes.back().added == actual)
+        {
+            m_changes.back().removed += removed;
+            m_changes.back().added += added;
+            return;
+        }
+        m_changes.push_back({ expected, actual, removed, added });
+    }
+
+    // expected[a_begin, a_end) against actual[b_begin, b_end)
+    void Compare(size_t a_begin, size_t a_end, size_t b_begin, size_t b_end)
+    {
+        while (a_begin < a_end && b_begin < b_end && m_expected(a_begin) == m_actual(b_begin))
+        {
+            ++a_begin;
+            ++b_begin;
+        }
+        while (a_begin < a_end && b_begin < b_end && m_expected(a_end - 1) == m_actual(b_end - 1))
+        {
+            --a_end;
+            --b_end;
+        }
+        if (a_begin == a_end || b_begin == b_end || m_budget <= 0)
+        {
+            m_capped = m_capped || (a_begin != a_end && b_begin != b_end);
+            Add(a_begin, b_begin, a_end - a_begin, b_end - b_begin);
+            return;
+        }
+        size_t a_split = 0;
+        size_t b_split = 0;
+        if constexpr (Hashable<T>)
+        {
+            if (a_end - a_begin >= PatienceLength && b_end - b_begin >= PatienceLength &&
+                a_end - a_begin <= MaxPatienceLength && b_end - b_begin <= MaxPatienceLength)
+            {
+                // Myers first, on a short budget, as it is quicker than hashing everything when there are few edits
+                const ptrdiff_t budget = m_budget;
+                auto trial = static_cast<ptrdiff_t>(TrialComparisons * (a_end - a_begin + b_end - b_begin));
+                trial = trial < budget / 2 ? trial : budget / 2;
+                m_budget = trial;
+                const bool found = MiddleSnake(a_begin, a_end, b_begin, b_end, a_split, b_split);
+                m_budget = budget - (trial - m_budget);
+                if (!found && Patience(a_begin, a_end, b_begin, b_end))
+                {
+                    return;
+                }
+                if (found)
+                {
+                    Compare(a_begin, a_split, b_begin, b_split);
+                    Compare(a_split, a_end, b_split, b_end);
+                    return;
+                }
+            }
+        }
+        if (MiddleSnake(a_begin, a_end, b_begin, b_end, a_split, b_split))
+        {
+            Compare(a_begin, a_split, b_begin, b_split);
+            Compare(a_split, a_end, b_split, b_end);
+            return;
+        }
+        // Either nothing is left in common, or a bound was reached
+        m_capped = m_capped || m_budget <= 0 || (a_end - a_begin + b_end - b_begin + 1) / 2 > MaxDepth;
+        Add(a_begin, b_begin, a_end - a_begin, b_end - b_begin);
+    }
+
+    // Splits at the elements that are there once on each side and in the same order; false if there are none
+    bool Patience(const size_t a_begin, const size_t a_end, const size_t b_begin, const size_t b_end)
+    {
+        // The index of each element of expected plus one, or -1 for one that is there more than once
+        ElementCounts<T> in_expected(a_end - a_begin);
+        for (size_t a = a_begin; a < a_end; ++a)
+        {
+            auto& seen = in_expected[&m_expected(a)];
+            seen = seen == 0 ? static_cast<ptrdiff_t>(a + 1) : -1;
+        }
+        // For each of those that are there once, the index in actual plus one, or -1 if it is there more than once
+        std::vector<ptrdiff_t> in_actual(a_end - a_begin, 0);
+        for (size_t b = b_begin; b < b_end; ++b)
+        {
+            if (const auto* a = in_expected.Find(m_actual(b)); a != nullptr && *a > 0)
+            {
+                auto& seen = in_actual[static_cast<size_t>(*a - 1) - a_begin];
+                seen = seen == 0 ? static_cast<ptrdiff_t>(b + 1) : -1;
+            }
+        }
+        std::vector<std::pair<size_t, size_t>> unique;
+        for (size_t a = a_begin; a < a_end; ++a)
+        {
+            if (const ptrdiff_t b = in_actual[a - a_begin]; b > 0)
+            {
+                unique.emplace_back(a, static_cast<size_t>(b - 1));
+            }
+        }
+        if (unique.empty())
+        {
+            return false;
+        }
+        // The longest run of them in the same order on both sides, by patience sorting on the actual index
+        std::vector<size_t> tails;
+        std::vector<size_t> previous(unique.size());
+        for (size_t index = 0; index < unique.size(); ++index)
+        {
+            const auto tail = std::lower_bound(tails.begin(), tails.end(), unique[index].second,
+                [&unique](const size_t other, const size_t b) { return unique[other].second < b; });
+            previous[index] = tail == tails.begin() ? unique.size() : *(tail - 1);
+            if (tail == tails.end())
+            {
+                tails.push_back(index);
+            }
+            else
+            {
+                *tail = index;
+            }
+        }
+        std::vector<std::pair<size_t, size_t>> anchors(tails.size());
+        for (size_t index = tails.back(), at = anchors.size(); at > 0; index = previous[index])
+        {
+            anchors[--at] = unique[index];
+        }
+        size_t a = a_begin;
+        size_t b = b_begin;
+        for (const auto& [a_anchor, b_anchor] : anchors)
+        {
+            Compare(a, a_anchor, b, b_anchor);
+            a = a_anchor + 1;
+            b = b_anchor + 1;
+        }
+        Compare(a, a_end, b, b_end);
+        return true;
+    }
+
+    // Where the forward and backward searches for a shortest script meet; false past the bounds
+    bool MiddleSnake(const size_t a_begin, const size_t a_end, const size_t b_begin, const size_t b_end,
+        size_t& a_split, size_t& b_split)
+    {
+        const auto n = static_cast<ptrdiff_t>(a_end - a_begin);
+        const auto m = static_cast<ptrdiff_t>(b_end - b_begin);
+        const ptrdiff_t max_depth = (n + m + 1) / 2 < static_cast<ptrdiff_t>(MaxDepth) ? (n + m + 1) / 2
+                                                                                   : static_cast<ptrdiff_t>(MaxDepth);
+        const ptrdiff_t v_offset = max_depth;
+        const ptrdiff_t v_length = 2 * max_depth + 2;
+        m_forward.assign(static_cast<size_t>(v_length), -1);
+        m_backward.assign(static_cast<size_t>(v_length), -1);
+        m_forward[static_cast<size_t>(v_offset + 1)] = 0;
+        m_backward[static_cast<size_t>(v_offset + 1)] = 0;
+        const ptrdiff_t delta = n - m;
+        // With an odd delta the forward search finds the overlap, otherwise the backward one does
+        const bool front = delta % 2 != 0;
+        ptrdiff_t k1_start = 0;
+        ptrdiff_t k1_end = 0;
+        ptrdiff_t k2_start = 0;
+        ptrdiff_t k2_end = 0;
+        const auto at = [](std::vector<ptrdiff_t>& v, const ptrdiff_t index) -> ptrdiff_t& {
+            return v[static_cast<size_t>(index)];
+        };
+        for (ptrdiff_t d = 0; d < max_depth && m_budget > 0; ++d)
+        {
+            for (ptrdiff_t k1 = -d + k1_start; k1 <= d - k1_end; k1 += 2)
+            {
+                const ptrdiff_t k1_offset = v_offset + k1;
+                ptrdiff_t x1 = k1 == -d || (k1 != d && at(m_forward, k1_offset - 1) < at(m_forward, k1_offset + 1))
+                    ? at(m_forward, k1_offset + 1)
+                    : at(m_forward, k1_offset - 1) + 1;
+                ptrdiff_t y1 = x1 - k1;
+                while (x1 < n && y1 < m &&
+                    Equal(a_begin + static_cast<size_t>(x1), b_begin + static_cast<size_t>(y1)))
+                {
+                    ++x1;
+                    ++y1;
+                }
+                at(m_forward, k1_offset) = x1;
+                if (x1 > n)
+                {
+                    k1_end += 2;
+                }
+                else if (y1 > m)
+                {
+                    k1_start += 2;
+                }
+                else if (front)
+                {
+                    const ptrdiff_t k2_offset = v_offset + delta - k1;
+                    if (k2_offset >= 0 && k2_offset < v_length && at(m_backward, k2_offset) != -1 &&
+                        x1 >= n - at(m_backward, k2_offset))
+                    {
+                        a_split = a_begin + static_cast<size_t>(x1);
+                        b_split = b_begin + static_cast<size_t>(y1);
+                        return true;
+                    }
+                }
+            }
+            for (ptrdiff_t k2 = -d + k2_start; k2 <= d - k2_end; k2 += 2)
+            {
+                const ptrdiff_t k2_offset = v_offset + k2;
+                ptrdiff_t x2 = k2 == -d || (k2 != d && at(m_backward, k2_offset - 1) < at(m_backward, k2_offset + 1))
+                    ? at(m_backward, k2_offset + 1)
+                    : at(m_backward, k2_offset - 1) + 1;
+                ptrdiff_t y2 = x2 - k2;
+                while (x2 < n && y2 < m &&
+                    Equal(a_begin + static_cast<size_t>(n - x2 - 1), b_begin + static_cast<size_t>(m - y2 - 1)))
+                {
+                    ++x2;
+                    ++y2;
+                }
+                at(m_backward, k2_offset) = x2;
+                if (x2 > n)
+                {
+                    k2_end += 2;
+                }
+                else if (y2 > m)
+                {
+                    k2_start += 2;
+                }
+                else if (!front)
+                {
+                    const ptrdiff_t k1_offset = v_offset + delta - k2;
+                    if (k1_offset >= 0 && k1_offset < v_length && at(m_forward, k1_offset) != -1)
+                    {
+                        const ptrdiff_t x1 = at(m_forward, k1_offset);
+                        const ptrdiff_t y1 = v_offset + x1 - k1_offset;
+                        if (x1 >= n - x2)
+                        {
+                            a_split = a_begin + static_cast<size_t>(x1);
+                            b_split = b_begin + static_cast<size_t>(y1);
+                            return true;
+                        }
+                    }
+                }
+            }
+        }
+        return false;
+    }
+
+    size_t m_expected_size;
+    size_t m_actual_size;
+    TExpected m_expected;
+    TActual m_actual;
+    size_t m_offset;
+    // Element comparisons left before the search gives up
+    ptrdiff_t m_budget = ptrdiff_t{ 1 } << 24;
+    bool m_capped = false;
+    std::vector<Change> m_changes;
+    std::vector<ptrdiff_t> m_forward;
+    std::vector<ptrdiff_t> m_backward;
+};
+
+///
+/// "Diff (expected -, actual +): 2 removed, 3 added", and whether it is the shortest
+template <typename TDiff> std::string DiffSummary(const TDiff& diff)
+{
+    size_t removed = 0;
+    size_t added = 0;
+    for (const auto& change : diff.Changes())
+    {
+        removed += change.removed;
+        added += change.added;
+    }
+    return "Diff (expected -, actual +): " + std::to_string(removed) + " removed, " + std::to_string(added) + " added" +
+        (diff.Shortest() ? "" : ", not the shortest");
+}
+
+///
+/// Failure path only: the reason two sequences are not equal, where `expected(i)` and `actual(i)` give their elements
+/// by reference, from index `offset` on; the elements before it are equal, and not shown.
+/// The same length: the summary of the mismatches, followed by the diff if it takes fewer edits than the mismatches,
+/// as it does when some elements have been inserted and as many removed. Otherwise the lengths and the diff
+template <typename T, typename TExpected, typename TActual, typename TFormat>
+std::string DescribeDifferences(const char* subject, const size_t expected_size, const size_t actual_size,
+    TExpected expected, TActual actual, const TFormat format, const size_t offset = 0)
+{
+    std::string text;
+    size_t mismatches = 0;
+    if (expected_size == actual_size)
+    {
+        MismatchSummary<T, TFormat> summary(offset + actual_size, format);
+        for (size_t i = 0; i < actual_size; ++i)
+        {
+            if (expected(i) != actual(i))
+            {
+                summary.Add(offset + i, expected(i), actual(i));
+            }
+        }
+        mismatches = summary.Count();
+        text.append(subject).append(" contents differ: ").append(summary.Text());
+    }
+    else
+    {
+        text.append(subject).append(" lengths differ: expected ").append(std::to_string(offset + expected_size));
+        text.append(", found ").append(std::to_string(offset + actual_size));
+    }
+    // A single mismatch is as short as a diff gets
+    if (expected_size != actual_size || mismatches > 1)
+    {
+        const Diff<T, TExpected, TActual> diff(expected_size, actual_size, std::move(expected), std::move(actual), offset);
+        if (expected_size != actual_size || diff.Edits() < 2 * mismatches)
+        {
+            text.append("\n").append(DiffSummary(diff)).append("\n").append(diff.Text(format));
+        }
+    }
+    return text;
+}
+}    // namespace detail
+}    //namespace evolutional
@@ -0,0 +1,281 @@
+#pragma once
+
+/*
+ *    Copyright 2014 Oli Wilkinson
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *        distributed under the License is distributed on an "AS IS" BASIS,
+ *        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *        See the License for the specific language governing permissions and
+ *        limitations under the License.
+ *
+ *    Then modified by Smurf-IV from 2022-12-12 onwards
+ *    https://github.com/Smurf-IV/FluentAssertions-for-Cpp/commits/master
+ *    Current date is 2023-06-14
+ */
+
+// The order independent comparison behind `BeEquivalentTo`, and the hash table it shares with `ContainAll`;
+// included by ChamoisContainers.hpp and ChamoisRanges.hpp.
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ChamoisCore.hpp"
+
+namespace evolutional
+{
+namespace detail
+{
+template <typename T>
+concept Hashable = requires(const T& value) {
+    { std::hash<T>{}(value) } -> std::convertible_to<size_t>;
+};
+
+template <typename T>
+concept LessThanComparable = requires(const T& lhs, const T& rhs) {
+    { lhs < rhs } -> std::convertible_to<bool>;
+};
+
+///
+/// The address of each element of `range`, in a single pass; elements it yields by value are copied into `copies`,
+/// a deque so that their addresses stay put, and which unlike a `std::vector<bool>` holds real `bool`s
+template <typename T, typename TRange> std::vector<const T*> ElementAddresses(TRange&& range, std::deque<T>& copies)
+{
+    std::vector<const T*> addresses;
+    if constexpr (std::ranges::sized_range<TRange>)
+    {
+        addresses.reserve(static_cast<size_t>(std::ranges::size(range)));
+    }
+    using reference = std::ranges::range_reference_t<TRange>;
+    if constexpr (std::is_lvalue_reference_v<reference> && std::is_same_v<std::remove_cvref_t<reference>, T>)
+    {
+        for (const T& element : range)
+        {
+            addresses.push_back(&element);
+        }
+    }
+    else
+    {
+        for (auto&& element : range)
+        {
+            addresses.push_back(&copies.emplace_back(std::forward<decltype(element)>(element)));
+        }
+    }
+    return addresses;
+}
+
+///
+/// A count for each distinct element, in an open addressing hash table of element addresses.
+/// The table is sized up front for `distinct` elements, so counting does not allocate; the elements must outlive it
+template <typename T> class ElementCounts
+{
+public:
+    explicit ElementCounts(const size_t distinct)
+    {
+        while ((size_t{ 1 } << m_bits) < 2 * distinct)
+        {
+            ++m_bits;
+        }
+        m_entries.resize(size_t{ 1 } << m_bits, { nullptr, 0 });
+    }
+
+    /// The count of `element`, which is added with a count of 0 if it is not there yet
+    std::ptrdiff_t& operator[](const T* element)
+    {
+        auto& entry = m_entries[Slot(*element)];
+        entry.first = element;
+        return entry.second;
+    }
+
+    /// The count of `element`, or nullptr if it is not there
+    [[nodiscard]] std::ptrdiff_t* Find(const T& element)
+    {
+        auto& entry = m_entries[Slot(element)];
+        return entry.first != nullptr ? &entry.second : nullptr;
+    }
+
+    /// Every slot; the empty ones hold nullptr and a count of 0
+    [[nodiscard]] const std::vector<std::pair<const T*, std::ptrdiff_t>>& Entries() const noexcept
+    {
+        return m_entries;
+    }
+
+private:
+    // The slot holding `element`, or the empty one where it would go
+    size_t Slot(const T& element) const
+    {
+        // Fibonacci hashing: the top bits of the product, so hashes that are the values themselves (integers) spread
+        const std::uint64_t hash = std::hash<T>{}(element);
+        auto slot = static_cast<size_t>((hash * 0x9E3779B97F4A7C15ull) >> (64 - m_bits));
+        while (m_entries[slot].first != nullptr && !(*m_entries[slot].first == element))
+        {
+            slot = (slot + 1) & (m_entries.size() - 1);
+        }
+        return slot;
+    }
+
+    int m_bits = 4;
+    std::vector<std::pair<const T*, std::ptrdiff_t>> m_entries;
+};
+
+///
+/// Whether two collections hold the same elements, each as many times, in any order.
+/// Counts every element of both in a hash table of element addresses (expected O(n)), or, for elements that have no
+/// `std::hash` but do have `<`, sorts the addresses (O(n log n)).
+/// Elements are only copied when a side yields them by value, e.g. a `std::views::transform`.
+/// Both sides are read in a single pass, and when they are equal position by position nothing is counted at all.
+template <typename T> class Equivalence
+{
+public:
+    template <typename TActual, typename TExpected> Equivalence(TActual&& actual, TExpected&& expected)
+    {
+        static_assert(Hashable<T> || LessThanComparable<T>,
+            "BeEquivalentTo needs elements with a std::hash specialisation, or an operator<");
+        if constexpr (std::ranges::forward_range<TActual> && std::ranges::forward_range<TExpected>)
+        {
+            if (std::ranges::equal(actual, expected))
+            {
+                return;
+            }
+        }
+        const std::vector<const T*> actual_elements = ElementAddresses(actual, m_actual_copies);
+        const std::vector<const T*> expected_elements = ElementAddresses(expected, m_expected_copies);
+        m_actual_count = actual_elements.size();
+        m_expected_count = expected_elements.size();
+        if constexpr (Hashable<T>)
+        {
+            CountHashed(actual_elements, expected_elements);
+        }
+        else
+        {
+            CountSorted(actual_elements, expected_elements);
+        }
+    }
+
+    [[nodiscard]] bool Equivalent() const noexcept
+    {
+        return m_differences.empty();
+    }
+
+    /// The missing and surplus elements with their multiplicities, `format` turns an element into text
+    template <typename TFormat> [[nodiscard]] std::string Text(const TFormat format) const
+    {
+        size_t missing = 0;
+        size_t surplus = 0;
+        for (const auto& [element, difference] : m_differences)
+        {
+            (difference > 0 ? missing : surplus) += static_cast<size_t>(difference > 0 ? difference : -difference);
+        }
+        std::string text = "Collections are not equivalent: " + std::to_string(missing) + " of " +
+            std::to_string(m_expected_count) + " expected elements are missing, " + std::to_string(surplus) + " of " +
+            std::to_string(m_actual_count) + " found are surplus";
+        AppendElements(text, "\nMissing: ", true, format);
+        AppendElements(text, "\nSurplus: ", false, format);
+        return text;
+    }
+
+private:
+    void CountHashed(const std::vector<const T*>& actual, const std::vector<const T*>& expected)
+    {
+        // Both sides go into the one table, so when they have nothing in common there are as many keys as elements
+        ElementCounts<T> counts(actual.size() + expected.size());
+        for (const T* element : expected)
+        {
+            ++counts[element];
+        }
+        for (const T* element : actual)
+        {
+            --counts[element];
+        }
+        for (const auto& [element, difference] : counts.Entries())
+        {
+            if (difference != 0)
+            {
+                m_differences.emplace_back(element, difference);
+            }
+        }
+    }
+
+    void CountSorted(const std::vector<const T*>& actual, const std::vector<const T*>& expected)
+    {
+        std::vector<std::pair<const T*, std::ptrdiff_t>> elements;
+        elements.reserve(actual.size() + expected.size());
+        for (const T* element : expected)
+        {
+            elements.emplace_back(element, 1);
+        }
+        for (const T* element : actual)
+        {
+            elements.emplace_back(element, -1);
+        }
+        std::sort(elements.begin(), elements.end(),
+            [](const auto& lhs, const auto& rhs) { return *lhs.first < *rhs.first; });
+        for (size_t start = 0; start < elements.size();)
+        {
+            std::ptrdiff_t difference = 0;
+            size_t end = start;
+            for (; end < elements.size() && !(*elements[start].first < *elements[end].first); ++end)
+            {
+                difference += elements[end].second;
+            }
+            if (difference != 0)
+            {
+                m_differences.emplace_back(elements[start].first, difference);
+            }
+            start = end;
+        }
+    }
+
+    template <typename TFormat>
+    void AppendElements(std::string& text, const char* heading, const bool missing, const TFormat format) const
+    {
+        size_t listed = 0;
+        size_t unlisted = 0;
+        for (const auto& [element, difference] : m_differences)
+        {
+            if ((difference > 0) != missing)
+            {
+                continue;
+            }
+            if (listed == CHAMOIS_MISMATCH_INDEX_LIMIT)
+            {
+                ++unlisted;
+                continue;
+            }
+            text += (listed++ == 0 ? heading : ", ") + format(*element);
+            const auto times = difference > 0 ? difference : -difference;
+            if (times > 1)
+            {
+                text += " (x" + std::to_string(times) + ")";
+            }
+        }
+        if (unlisted > 0)
+        {
+            text += ", ... (" + std::to_string(unlisted) + " more)";
+        }
+    }
+
+    std::deque<T> m_actual_copies;
+    std::deque<T> m_expected_copies;
+    size_t m_actual_count = 0;
+    size_t m_expected_count = 0;
+    // Each distinct element that differs, and how many more times it is expected than found
+    std::vector<std::pair<const T*, std::ptrdiff_t>> m_differences;
+};
+}    // namespace detail
+}    //namespace evolutional
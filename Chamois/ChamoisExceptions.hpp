@@ -0,0 +1,103 @@
+#pragma once
+
+/*
+ *    Copyright 2014 Oli Wilkinson
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *        distributed under the License is distributed on an "AS IS" BASIS,
+ *        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *        See the License for the specific language governing permissions and
+ *        limitations under the License.
+ *
+ *    Then modified by Smurf-IV from 2022-12-12 onwards
+ *    https://github.com/Smurf-IV/FluentAssertions-for-Cpp/commits/master
+ *    Current date is 2023-06-14
+ */
+
+// Opt-in `Should().Throw` / `Should().NotThrow` support; also included by Chamois.hpp.
+
+#include "ChamoisCore.hpp"
+
+namespace evolutional
+{
+namespace detail
+{
+template <class TAssertImpl, typename FUNCTOR> class ShouldExceptionImpl
+{
+public:
+    explicit ShouldExceptionImpl(FUNCTOR func)
+        : m_func(func)
+    {
+    }
+
+    template<typename _EXPECTEDEXCEPTION>
+    void _throw(const char* file, const int line, const std::string_view because = {})
+    {
+        static_assert(std::is_base_of_v<std::exception, _EXPECTEDEXCEPTION>, "ExceptionType must be derived from std::exception");
+        TAssertImpl::template Throw< _EXPECTEDEXCEPTION, FUNCTOR>(m_func, FailureContext(file, line, because));
+    }
+
+    template<typename NOTEXPECTEDEXCEPTION>
+    void _notThrow(const char* file, const int line, const std::string_view because = {})
+    {
+        static_assert(std::is_base_of_v<std::exception, NOTEXPECTEDEXCEPTION>, "ExceptionType must be derived from std::exception");
+        TAssertImpl::template NotThrow< NOTEXPECTEDEXCEPTION, FUNCTOR>(m_func, FailureContext(file, line, because));
+    }
+
+#ifdef CHAMOIS_NO_MACROS
+    template <typename _EXPECTEDEXCEPTION>
+    void Throw(const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _throw<_EXPECTEDEXCEPTION>(location.file_name(), static_cast<int>(location.line()), because);
+    }
+
+    template <typename NOTEXPECTEDEXCEPTION>
+    void NotThrow(const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _notThrow<NOTEXPECTEDEXCEPTION>(location.file_name(), static_cast<int>(location.line()), because);
+    }
+#endif
+
+private:
+    const FUNCTOR m_func;
+};
+
+template <class TAssertImpl, typename FUNCTOR> class ExceptionImpl
+{
+public:
+    explicit ExceptionImpl(FUNCTOR func)
+        : m_func(func)
+    {
+    }
+
+    ShouldExceptionImpl<TAssertImpl, FUNCTOR> Should()
+    {
+        return ShouldExceptionImpl<TAssertImpl, FUNCTOR>(m_func);
+    }
+
+private:
+    const FUNCTOR m_func;
+};
+}    // namespace detail
+
+template <class TAssertImpl>
+detail::ExceptionImpl<TAssertImpl, void (*)()> BasicAssert<TAssertImpl>::That(void (*func)())
+{
+    return detail::ExceptionImpl<TAssertImpl, void (*)()>(func);
+}
+
+template <class TAssertImpl>
+template <typename FUNCTOR>
+detail::ExceptionImpl<TAssertImpl, FUNCTOR> BasicAssert<TAssertImpl>::ThatLambda(FUNCTOR func)
+{
+    return detail::ExceptionImpl<TAssertImpl, FUNCTOR>(func);
+}
+}    //namespace evolutional
@@ -0,0 +1,439 @@
+#pragma once
+
+/*
+ *    Copyright 2014 Oli Wilkinson
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *        distributed under the License is distributed on an "AS IS" BASIS,
+ *        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *        See the License for the specific language governing permissions and
+ *        limitations under the License.
+ *
+ *    Then modified by Smurf-IV from 2022-12-12 onwards
+ *    https://github.com/Smurf-IV/FluentAssertions-for-Cpp/commits/master
+ *    Current date is 2023-06-14
+ */
+
+// Opt-in `Assert::ThatFile` support, comparing files through memory mappings; also included by Chamois.hpp.
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "ChamoisCore.hpp"
+
+///
+/// Files are mapped and compared this many bytes at a time, so no more than twice this is mapped at once,
+/// whatever the size of the files; a multiple of 64 KiB, the coarsest mapping granularity (Windows)
+#ifndef CHAMOIS_FILE_CHUNK_SIZE
+#define CHAMOIS_FILE_CHUNK_SIZE (size_t{ 64 } * 1024 * 1024)
+#endif
+
+namespace evolutional
+{
+namespace detail
+{
+inline std::string DescribePath(const std::filesystem::path& path)
+{
+#ifdef _WIN32
+    return "\"" + Narrow(std::wstring_view(path.native())) + "\"";
+#else
+    return "\"" + path.native() + "\"";
+#endif
+}
+
+///
+/// A read only file, mapped into memory one window at a time.
+/// Opening does not fail the test by itself: `Error()` says what went wrong, for the verb to report
+class MappedFile
+{
+public:
+    explicit MappedFile(const std::filesystem::path& path)
+    {
+#ifdef _WIN32
+        m_file = ::CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+            FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        LARGE_INTEGER size{};
+        if (m_file == INVALID_HANDLE_VALUE || !::GetFileSizeEx(m_file, &size))
+        {
+            SetError(path);
+            return;
+        }
+        m_size = static_cast<std::uint64_t>(size.QuadPart);
+        // An empty file cannot be mapped, and has nothing to map
+        if (m_size != 0 && (m_mapping = ::CreateFileMappingW(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr)) == nullptr)
+        {
+            SetError(path);
+            return;
+        }
+        SYSTEM_INFO system{};
+        ::GetSystemInfo(&system);
+        m_granularity = system.dwAllocationGranularity;
+#else
+        struct stat status{};
+        if ((m_file = ::open(path.c_str(), O_RDONLY | O_CLOEXEC)) < 0 || ::fstat(m_file, &status) != 0)
+        {
+            SetError(path);
+            return;
+        }
+        m_size = static_cast<std::uint64_t>(status.st_size);
+        m_granularity = static_cast<std::uint64_t>(::sysconf(_SC_PAGESIZE));
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile()
+    {
+        Unmap();
+#ifdef _WIN32
+        if (m_mapping != nullptr)
+        {
+            ::CloseHandle(m_mapping);
+        }
+        if (m_file != INVALID_HANDLE_VALUE)
+        {
+            ::CloseHandle(m_file);
+        }
+#else
+        if (m_file >= 0)
+        {
+            ::close(m_file);
+        }
+#endif
+    }
+
+    /// Empty if the file is open, otherwise why not
+    [[nodiscard]] const std::string& Error() const noexcept
+    {
+        return m_error;
+    }
+
+    [[nodiscard]] std::uint64_t Size() const noexcept
+    {
+        return m_size;
+    }
+
+    /// The `length` bytes from `offset` on, which must be within the file, replacing the window mapped before;
+    /// nullptr, with `Error()` set, if they cannot be mapped
+    const unsigned char* Map(const std::uint64_t offset, const size_t length)
+    {
+        Unmap();
+        if (length == 0)
+        {
+            return nullptr;
+        }
+        // Mappings start on a granularity boundary, so the window starts a little before offset
+        const std::uint64_t start = offset - offset % m_granularity;
+        m_view_length = static_cast<size_t>(offset - start) + length;
+#ifdef _WIN32
+        m_view = ::MapViewOfFile(m_mapping, FILE_MAP_READ, static_cast<DWORD>(start >> 32),
+            static_cast<DWORD>(start & 0xFFFFFFFFu), m_view_length);
+        if (m_view == nullptr)
+        {
+            SetError({});
+            return nullptr;
+        }
+#else
+        m_view = ::mmap(nullptr, m_view_length, PROT_READ, MAP_PRIVATE, m_file, static_cast<off_t>(start));
+        if (m_view == MAP_FAILED)
+        {
+            m_view = nullptr;
+            SetError({});
+            return nullptr;
+        }
+        // The window is read once, front to back
+        ::madvise(m_view, m_view_length, MADV_SEQUENTIAL);
+#endif
+        return static_cast<const unsigned char*>(m_view) + (offset - start);
+    }
+
+private:
+    void Unmap() noexcept
+    {
+        if (m_view != nullptr)
+        {
+#ifdef _WIN32
+            ::UnmapViewOfFile(m_view);
+#else
+            ::munmap(m_view, m_view_length);
+#endif
+            m_view = nullptr;
+        }
+    }
+
+    CHAMOIS_COLD void SetError(const std::filesystem::path& path)
+    {
+#ifdef _WIN32
+        const std::error_code error(static_cast<int>(::GetLastError()), std::system_category());
+#else
+        const std::error_code error(errno, std::generic_category());
+#endif
+        m_error = (path.empty() ? "Could not map the file: " : "Could not open " + DescribePath(path) + ": ") +
+            error.message();
+    }
+
+#ifdef _WIN32
+    HANDLE m_file = INVALID_HANDLE_VALUE;
+    HANDLE m_mapping = nullptr;
+#else
+    int m_file = -1;
+#endif
+    std::uint64_t m_size = 0;
+    std::uint64_t m_granularity = 1;
+    void* m_view = nullptr;
+    size_t m_view_length = 0;
+    std::string m_error;
+};
+
+///
+/// Failure path only: the two rows of 16 bytes around `at`, in hex and as text, of both sides.
+/// `expected` and `actual` hold the bytes from `start` on, up to their lengths; a caret marks the byte at `at`
+CHAMOIS_COLD inline std::string HexContext(const unsigned char* expected, const size_t expected_length,
+    const unsigned char* actual, const size_t actual_length, const std::uint64_t start, const std::uint64_t at)
+{
+    constexpr char digits[] = "0123456789abcdef";
+    std::string text;
+    const auto append_row = [&text, &digits, start](const char* label, const unsigned char* bytes, const size_t length,
+                                const std::uint64_t row) {
+        text.append("\n").append(label);
+        for (int shift = 60; shift >= 0; shift -= 4)
+        {
+            text += digits[(row >> shift) & 0xF];
+        }
+        text += ':';
+        std::string printable;
+        for (std::uint64_t offset = row; offset < row + 16; ++offset)
+        {
+            if (const size_t index = static_cast<size_t>(offset - start); offset >= start && index < length)
+            {
+                text.append(" ").append(1, digits[bytes[index] >> 4]).append(1, digits[bytes[index] & 0xF]);
+                printable += bytes[index] >= 0x20 && bytes[index] < 0x7F ? static_cast<char>(bytes[index]) : '.';
+            }
+            else
+            {
+                text.append("   ");
+                printable += ' ';
+            }
+        }
+        text.append("  ").append(printable);
+        text.erase(text.find_last_not_of(' ') + 1);
+    };
+    for (std::uint64_t row = start - start % 16; row < start + 32; row += 16)
+    {
+        // A row past the end of both sides would be blank
+        if (row >= start + expected_length && row >= start + actual_length && row > at)
+        {
+            break;
+        }
+        append_row("Expected ", expected, expected_length, row);
+        append_row("Found    ", actual, actual_length, row);
+        if (at >= row && at < row + 16)
+        {
+            // Under the found byte: the label, 16 digits of offset and ':', then 3 characters a byte
+            text.append("\n").append(9 + 16 + 1 + 3 * static_cast<size_t>(at - row) + 1, ' ').append("^^");
+        }
+    }
+    return text;
+}
+
+template <class TAssertImpl> class ShouldFileImpl
+{
+public:
+    explicit ShouldFileImpl(std::filesystem::path path)
+        : m_path(std::move(path))
+    {
+    }
+
+    void _haveSameContentAsFunc(const char* file, const int line, const std::filesystem::path& expected_path,
+        const std::string_view because = {})
+    {
+        MappedFile actual(m_path);
+        MappedFile expected(expected_path);
+        const FailureContext context(file, line, because);
+        if (!actual.Error().empty() || !expected.Error().empty())
+        {
+            TAssertImpl::AssertFail(context.WithReason(actual.Error().empty() ? expected.Error() : actual.Error()));
+            return;
+        }
+        const std::uint64_t common = actual.Size() < expected.Size() ? actual.Size() : expected.Size();
+        for (std::uint64_t offset = 0; offset < common; offset += CHAMOIS_FILE_CHUNK_SIZE)
+        {
+            const size_t length = static_cast<size_t>(
+                common - offset < CHAMOIS_FILE_CHUNK_SIZE ? common - offset : CHAMOIS_FILE_CHUNK_SIZE);
+            const unsigned char* const actual_bytes = actual.Map(offset, length);
+            const unsigned char* const expected_bytes = expected.Map(offset, length);
+            if (actual_bytes == nullptr || expected_bytes == nullptr)
+            {
+                TAssertImpl::AssertFail(context.WithReason(actual_bytes == nullptr ? actual.Error() : expected.Error()));
+                return;
+            }
+            if (const size_t first = FirstMismatchBytes(expected_bytes, actual_bytes, length); first != length)
+            {
+                ReportContentDiffers(actual, expected, expected_path, offset + first, context);
+                return;
+            }
+        }
+        if (actual.Size() != expected.Size())
+        {
+            TAssertImpl::AssertFail(context.WithReason("Files differ in size: expected " + DescribePath(expected_path) +
+                " is " + std::to_string(expected.Size()) + " bytes, found " + DescribePath(m_path) + " is " +
+                std::to_string(actual.Size()) + " bytes, and the first " + std::to_string(common) + " are the same"));
+        }
+    }
+
+    void _haveSizeFunc(const char* file, const int line, const std::uint64_t expected_size,
+        const std::string_view because = {})
+    {
+        std::error_code error;
+        const std::uint64_t size = std::filesystem::file_size(m_path, error);
+        if (error || size != expected_size)
+        {
+            TAssertImpl::AssertFail(FailureContext(file, line, because).WithReason(error
+                    ? "Could not read the size of " + DescribePath(m_path) + ": " + error.message()
+                    : "Expected " + DescribePath(m_path) + " to be " + std::to_string(expected_size) + " bytes, but it is " +
+                        std::to_string(size)));
+        }
+    }
+
+    /// `expected_prefix` is bytes, not text; a `std::string` or a `"..."sv` literal can hold zeros
+    void _startsWithFunc(const char* file, const int line, const std::string_view expected_prefix,
+        const std::string_view because = {})
+    {
+        MappedFile actual(m_path);
+        const FailureContext context(file, line, because);
+        if (!actual.Error().empty())
+        {
+            TAssertImpl::AssertFail(context.WithReason(actual.Error()));
+            return;
+        }
+        const auto* const expected = reinterpret_cast<const unsigned char*>(expected_prefix.data());
+        const size_t length = actual.Size() < expected_prefix.size() ? static_cast<size_t>(actual.Size())
+                                                                       : expected_prefix.size();
+        const unsigned char* const bytes = actual.Map(0, length);
+        if (length != 0 && bytes == nullptr)
+        {
+            TAssertImpl::AssertFail(context.WithReason(actual.Error()));
+            return;
+        }
+        const size_t first = length == 0 ? 0 : FirstMismatchBytes(expected, bytes, length);
+        if (first != expected_prefix.size())
+        {
+            ReportPrefixDiffers(expected, expected_prefix.size(), bytes, length, actual.Size(), first, context);
+        }
+    }
+
+#ifdef CHAMOIS_NO_MACROS
+    void HaveSameContentAs(const std::filesystem::path& expected_path, const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _haveSameContentAsFunc(location.file_name(), static_cast<int>(location.line()), expected_path, because);
+    }
+
+    void HaveSize(const std::uint64_t expected_size, const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _haveSizeFunc(location.file_name(), static_cast<int>(location.line()), expected_size, because);
+    }
+
+    void StartWith(const std::string_view expected_prefix, const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _startsWithFunc(location.file_name(), static_cast<int>(location.line()), expected_prefix, because);
+    }
+#endif
+
+private:
+    // Maps the rows around the first difference again, as they may straddle two chunks
+    CHAMOIS_COLD void ReportContentDiffers(MappedFile& actual, MappedFile& expected,
+        const std::filesystem::path& expected_path, const std::uint64_t at, const FailureContext& context) const
+    {
+        const std::uint64_t start = at - at % 16 >= 16 && at % 16 < 8 ? at - at % 16 - 16 : at - at % 16;
+        const auto available = [start](const MappedFile& side) {
+            return static_cast<size_t>(side.Size() - start < 32 ? side.Size() - start : 32);
+        };
+        const size_t expected_length = available(expected);
+        const size_t actual_length = available(actual);
+        // The window of one side is unmapped when the other is mapped, so copy each before mapping the next
+        unsigned char expected_bytes[32]{};
+        unsigned char actual_bytes[32]{};
+        if (const unsigned char* const bytes = expected.Map(start, expected_length); bytes != nullptr)
+        {
+            std::memcpy(expected_bytes, bytes, expected_length);
+        }
+        if (const unsigned char* const bytes = actual.Map(start, actual_length); bytes != nullptr)
+        {
+            std::memcpy(actual_bytes, bytes, actual_length);
+        }
+        TAssertImpl::AssertFail(context.WithReason("Files differ from byte " + std::to_string(at) + ": expected " +
+            DescribePath(expected_path) + ", " + std::to_string(expected.Size()) + " bytes, found " +
+            DescribePath(m_path) + ", " + std::to_string(actual.Size()) + " bytes" +
+            HexContext(expected_bytes, expected_length, actual_bytes, actual_length, start, at)));
+    }
+
+    CHAMOIS_COLD void ReportPrefixDiffers(const unsigned char* expected, const size_t expected_length,
+        const unsigned char* actual, const size_t actual_length, const std::uint64_t size, const size_t at,
+        const FailureContext& context) const
+    {
+        const size_t start = at - at % 16 >= 16 && at % 16 < 8 ? at - at % 16 - 16 : at - at % 16;
+        const auto window = [start](const size_t length) { return length - start < 32 ? length - start : 32; };
+        const std::string reason = at == actual_length
+            ? "Expected " + DescribePath(m_path) + " to start with " + std::to_string(expected_length) +
+                " bytes, but it is only " + std::to_string(size) + " bytes"
+            : "Expected " + DescribePath(m_path) + " to start with the " + std::to_string(expected_length) +
+                " bytes given, but they differ from byte " + std::to_string(at);
+        const size_t actual_window = actual_length > start ? window(actual_length) : 0;
+        TAssertImpl::AssertFail(context.WithReason(reason + HexContext(expected + start, window(expected_length),
+            actual_window != 0 ? actual + start : nullptr, actual_window, start, at)));
+    }
+
+    const std::filesystem::path m_path;
+};
+
+template <class TAssertImpl> class ThatFileImpl
+{
+public:
+    explicit ThatFileImpl(std::filesystem::path path)
+        : m_path(std::move(path))
+    {
+    }
+
+    ShouldFileImpl<TAssertImpl> Should()
+    {
+        return ShouldFileImpl<TAssertImpl>(m_path);
+    }
+
+private:
+    const std::filesystem::path m_path;
+};
+}    // namespace detail
+
+template <class TAssertImpl>
+template <typename TPath>
+detail::ThatFileImpl<TAssertImpl> BasicAssert<TAssertImpl>::ThatFile(const TPath& path)
+{
+    return detail::ThatFileImpl<TAssertImpl>(std::filesystem::path(path));
+}
+}    //namespace evolutional
@@ -0,0 +1,385 @@
+#pragma once
+
+/*
+ *    Copyright 2014 Oli Wilkinson
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *        distributed under the License is distributed on an "AS IS" BASIS,
+ *        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *        See the License for the specific language governing permissions and
+ *        limitations under the License.
+ *
+ *    Then modified by Smurf-IV from 2022-12-12 onwards
+ *    https://github.com/Smurf-IV/FluentAssertions-for-Cpp/commits/master
+ *    Current date is 2023-06-14
+ */
+
+// Opt-in `Assert::ThatRange` support; also included by Chamois.hpp.
+
+#include <cstddef>
+#include <deque>
+#include <initializer_list>
+#include <iterator>
+#include <ranges>
+#include <string>
+#include <utility>
+
+#include "ChamoisCore.hpp"
+#include "ChamoisDiff.hpp"
+#include "ChamoisEquivalence.hpp"
+
+namespace evolutional
+{
+namespace detail
+{
+///
+/// Any `std::ranges::input_range`: containers, C arrays, `std::span`, `std::string_view` and lazy view pipelines.
+/// `TView` is `std::views::all_t` of the subject, so an lvalue is referenced and an rvalue view is moved in; nothing is copied.
+/// Every verb makes at most one pass over the subject, so single pass (input) ranges work too.
+/// `Be` reads both sides in lockstep and stops at the first difference; when either is single pass, a stream that may
+/// not fit in memory, that difference is all a failure shows, and nothing is held.
+/// Contiguous ranges of the same element type are compared as arrays, see `FirstMismatch`.
+/// A failure shows all the mismatches, or the lengths, and a diff, see `DescribeDifferences`.
+template <class TAssertImpl, typename TView> class ShouldRangeImpl
+{
+public:
+    using value_type = std::ranges::range_value_t<TView>;
+
+    explicit ShouldRangeImpl(TView&& view)
+        : m_view(std::move(view))
+    {
+    }
+
+    template <std::ranges::input_range TExpected>
+    void _beFunc(const char* file, const int line, TExpected&& expected, const std::string_view because = {})
+    {
+        const FailureContext context(file, line, because);
+        if constexpr (IsArrayComparable<TExpected>)
+        {
+            const size_t expected_length = std::ranges::size(expected);
+            const size_t actual_length = std::ranges::size(m_view);
+            const size_t common = expected_length < actual_length ? expected_length : actual_length;
+            if (const size_t first = FirstMismatch(Data(expected), Data(m_view), common);
+                first != common || expected_length != actual_length)
+            {
+                const auto offset = static_cast<std::ptrdiff_t>(first);
+                ReportDifferences(std::ranges::begin(m_view) + offset, std::ranges::end(m_view),
+                    std::ranges::begin(expected) + offset, std::ranges::end(expected), first, context);
+            }
+        }
+        else
+        {
+            auto actual = std::ranges::begin(m_view);
+            const auto actual_end = std::ranges::end(m_view);
+            auto wanted = std::ranges::begin(expected);
+            const auto wanted_end = std::ranges::end(expected);
+            std::size_t pos = 0;
+            for (; actual != actual_end && wanted != wanted_end; ++actual, ++wanted, ++pos)
+            {
+                if (*actual != *wanted)
+                {
+                    break;
+                }
+            }
+            if (actual == actual_end && wanted == wanted_end)
+            {
+                return;
+            }
+            if constexpr (std::ranges::forward_range<TView> && std::ranges::forward_range<TExpected>)
+            {
+                ReportDifferences(std::move(actual), actual_end, std::move(wanted), wanted_end, pos, context);
+            }
+            else
+            {
+                ReportFirstDifference<std::ranges::range_value_t<TExpected>>(actual, actual_end, wanted, wanted_end,
+                    pos, context);
+            }
+        }
+    }
+
+    void _beFunc(const char* file, const int line, const std::initializer_list<value_type> expected,
+        const std::string_view because = {})
+    {
+        _beFunc<const std::initializer_list<value_type>&>(file, line, expected, because);
+    }
+
+    template <std::ranges::input_range TExpected>
+    void _notBeFunc(const char* file, const int line, TExpected&& expected, const std::string_view because = {})
+    {
+        if constexpr (IsArrayComparable<TExpected>)
+        {
+            TAssertImpl::AssertArrayNotEqual(Data(expected), std::ranges::size(expected), Data(m_view),
+                std::ranges::size(m_view), FailureContext(file, line, because));
+        }
+        else
+        {
+            auto actual = std::ranges::begin(m_view);
+            const auto actual_end = std::ranges::end(m_view);
+            auto wanted = std::ranges::begin(expected);
+            const auto wanted_end = std::ranges::end(expected);
+            for (; actual != actual_end && wanted != wanted_end; ++actual, ++wanted)
+            {
+                if (*actual != *wanted)
+                {
+                    return;
+                }
+            }
+            if (actual == actual_end && wanted == wanted_end)
+            {
+                TAssertImpl::AssertFail(FailureContext(file, line, because, "Range contents the same"));
+            }
+        }
+    }
+
+    void _notBeFunc(const char* file, const int line, const std::initializer_list<value_type> expected,
+        const std::string_view because = {})
+    {
+        _notBeFunc<const std::initializer_list<value_type>&>(file, line, expected, because);
+    }
+
+    template <std::ranges::input_range TExpected>
+    void _beEquivalentToFunc(const char* file, const int line, TExpected&& expected,
+        const std::string_view because = {})
+    {
+        if (const Equivalence<value_type> equivalence(m_view, expected); !equivalence.Equivalent())
+        {
+            TAssertImpl::AssertFail(
+                FailureContext(file, line, because).WithReason(equivalence.Text(&Describe<value_type>)));
+        }
+    }
+
+    void _beEquivalentToFunc(const char* file, const int line, const std::initializer_list<value_type> expected,
+        const std::string_view because = {})
+    {
+        _beEquivalentToFunc<const std::initializer_list<value_type>&>(file, line, expected, because);
+    }
+
+    template <std::ranges::input_range TExpected>
+    void _notBeEquivalentToFunc(const char* file, const int line, TExpected&& expected,
+        const std::string_view because = {})
+    {
+        if (Equivalence<value_type>(m_view, expected).Equivalent())
+        {
+            TAssertImpl::AssertFail(FailureContext(file, line, because, "Collections are equivalent"));
+        }
+    }
+
+    void _notBeEquivalentToFunc(const char* file, const int line, const std::initializer_list<value_type> expected,
+        const std::string_view because = {})
+    {
+        _notBeEquivalentToFunc<const std::initializer_list<value_type>&>(file, line, expected, because);
+    }
+
+    void _haveLengthFunc(const char* file, const int line, const size_t expected_length,
+        const std::string_view because = {})
+    {
+        TAssertImpl::AssertEqual(expected_length, Length(), FailureContext(file, line, because));
+    }
+
+    void _notHaveLengthFunc(const char* file, const int line, const size_t expected_length,
+        const std::string_view because = {})
+    {
+        TAssertImpl::AssertNotEqual(expected_length, Length(), FailureContext(file, line, because));
+    }
+
+    void _beEmptyFunc(const char* file, const int line, const std::string_view because = {})
+    {
+        TAssertImpl::AssertTrue(std::ranges::begin(m_view) == std::ranges::end(m_view), FailureContext(file, line, because));
+    }
+
+    void _notBeEmptyFunc(const char* file, const int line, const std::string_view because = {})
+    {
+        TAssertImpl::AssertFalse(std::ranges::begin(m_view) == std::ranges::end(m_view), FailureContext(file, line, because));
+    }
+
+#ifdef CHAMOIS_NO_MACROS
+    template <std::ranges::input_range TExpected>
+    void Be(TExpected&& expected, const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _beFunc(location.file_name(), static_cast<int>(location.line()), std::forward<TExpected>(expected), because);
+    }
+
+    void Be(const std::initializer_list<value_type> expected, const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _beFunc(location.file_name(), static_cast<int>(location.line()), expected, because);
+    }
+
+    template <std::ranges::input_range TExpected>
+    void NotBe(TExpected&& expected, const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _notBeFunc(location.file_name(), static_cast<int>(location.line()), std::forward<TExpected>(expected), because);
+    }
+
+    void NotBe(const std::initializer_list<value_type> expected, const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _notBeFunc(location.file_name(), static_cast<int>(location.line()), expected, because);
+    }
+
+    template <std::ranges::input_range TExpected>
+    void BeEquivalentTo(TExpected&& expected, const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _beEquivalentToFunc(location.file_name(), static_cast<int>(location.line()), std::forward<TExpected>(expected),
+            because);
+    }
+
+    void BeEquivalentTo(const std::initializer_list<value_type> expected, const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _beEquivalentToFunc(location.file_name(), static_cast<int>(location.line()), expected, because);
+    }
+
+    template <std::ranges::input_range TExpected>
+    void NotBeEquivalentTo(TExpected&& expected, const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _notBeEquivalentToFunc(location.file_name(), static_cast<int>(location.line()),
+            std::forward<TExpected>(expected), because);
+    }
+
+    void NotBeEquivalentTo(const std::initializer_list<value_type> expected, const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _notBeEquivalentToFunc(location.file_name(), static_cast<int>(location.line()), expected, because);
+    }
+
+    void HaveLength(const size_t expected_length, const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _haveLengthFunc(location.file_name(), static_cast<int>(location.line()), expected_length, because);
+    }
+
+    void NotHaveLength(const size_t expected_length, const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _notHaveLengthFunc(location.file_name(), static_cast<int>(location.line()), expected_length, because);
+    }
+
+    void BeEmpty(const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _beEmptyFunc(location.file_name(), static_cast<int>(location.line()), because);
+    }
+
+    void NotBeEmpty(const std::string_view because = {},
+        const std::source_location location = std::source_location::current())
+    {
+        _notBeEmptyFunc(location.file_name(), static_cast<int>(location.line()), because);
+    }
+#endif
+
+private:
+    // Both sized, contiguous and of the same element type: compared as memory where the elements allow it
+    template <typename TExpected>
+    static constexpr bool IsArrayComparable = std::ranges::contiguous_range<TView> && std::ranges::sized_range<TView> &&
+        std::ranges::contiguous_range<TExpected> && std::ranges::sized_range<TExpected> &&
+        std::is_same_v<std::ranges::range_value_t<TExpected>, value_type>;
+
+    template <typename TRange> static const value_type* Data(TRange&& range)
+    {
+        return static_cast<const value_type*>(std::ranges::data(range));
+    }
+
+    size_t Length()
+    {
+        return static_cast<size_t>(std::ranges::distance(m_view));
+    }
+
+    // Continues the pass from the first difference: all the mismatches, or the lengths, and the diff, as one failure
+    template <typename TActual, typename TActualEnd, typename TWanted, typename TWantedEnd>
+    CHAMOIS_COLD static void ReportDifferences(TActual actual, const TActualEnd actual_end, TWanted wanted,
+        const TWantedEnd wanted_end, const std::size_t pos, const FailureContext& context)
+    {
+        // Single pass ranges cannot be read again, so the rest of each is held by address, or copied if by value
+        std::deque<value_type> actual_copies;
+        std::deque<value_type> wanted_copies;
+        const auto actual_rest =
+            ElementAddresses(std::ranges::subrange(std::move(actual), actual_end), actual_copies);
+        const auto wanted_rest =
+            ElementAddresses(std::ranges::subrange(std::move(wanted), wanted_end), wanted_copies);
+        TAssertImpl::AssertFail(context.WithReason(DescribeDifferences<value_type>("Range", wanted_rest.size(),
+            actual_rest.size(), [&wanted_rest](const size_t i) -> const value_type& { return *wanted_rest[i]; },
+            [&actual_rest](const size_t i) -> const value_type& { return *actual_rest[i]; }, &Describe<value_type>,
+            pos)));
+    }
+
+    // A single pass range may be a stream too large to hold, so only the first difference is shown, and the rest of
+    // either side is not read
+    template <typename TWantedValue, typename TActual, typename TActualEnd, typename TWanted, typename TWantedEnd>
+    CHAMOIS_COLD static void ReportFirstDifference(const TActual& actual, const TActualEnd& actual_end,
+        const TWanted& wanted, const TWantedEnd& wanted_end, const std::size_t pos, const FailureContext& context)
+    {
+        const std::string at = std::to_string(pos);
+        if (actual == actual_end)
+        {
+            TAssertImpl::AssertFail(context.WithReason("Range is shorter than expected: it ends at index " + at +
+                ", where " + Describe<TWantedValue>(*wanted) + " is expected"));
+        }
+        else if (wanted == wanted_end)
+        {
+            TAssertImpl::AssertFail(context.WithReason("Range is longer than expected: found " +
+                Describe<value_type>(*actual) + " at index " + at + ", after the last expected element"));
+        }
+        else
+        {
+            TAssertImpl::AssertFail(context.WithReason("Range differs from index " + at + ": expected " +
+                Describe<TWantedValue>(*wanted) + ", found " + Describe<value_type>(*actual)));
+        }
+    }
+
+    TView m_view;
+};
+
+template <class TAssertImpl, typename TView> class ThatRangeImpl
+{
+public:
+    explicit ThatRangeImpl(TView&& view)
+        : m_view(std::move(view))
+    {
+    }
+
+    // A stored subject is only referenced, so that each of its Should() sees the whole range
+    ShouldRangeImpl<TAssertImpl, std::ranges::ref_view<TView>> Should() &
+    {
+        return ShouldRangeImpl<TAssertImpl, std::ranges::ref_view<TView>>(std::ranges::ref_view<TView>(m_view));
+    }
+
+    // A temporary subject hands its view on, as the ShouldRangeImpl may outlive it
+    ShouldRangeImpl<TAssertImpl, TView> Should() &&
+    {
+        return ShouldRangeImpl<TAssertImpl, TView>(std::move(m_view));
+    }
+
+private:
+    TView m_view;
+};
+}    // namespace detail
+
+template <class TAssertImpl>
+template <typename TRange>
+auto BasicAssert<TAssertImpl>::ThatRange(TRange&& range)
+{
+    static_assert(std::ranges::input_range<TRange> && std::ranges::viewable_range<TRange>,
+        "ThatRange takes a std::ranges::input_range: a container, array, span, string view or view pipeline");
+    return detail::ThatRangeImpl<TAssertImpl, std::views::all_t<TRange>>(std::views::all(std::forward<TRange>(range)));
+}
+
+template <class TAssertImpl>
+template <typename TIterator, typename TSentinel>
+auto BasicAssert<TAssertImpl>::ThatRange(TIterator first, TSentinel last)
+{
+    static_assert(std::input_iterator<TIterator> && std::sentinel_for<TSentinel, TIterator>,
+        "ThatRange takes an input iterator and its sentinel, such as a std::istream_iterator and the default one");
+    return ThatRange(std::ranges::subrange<TIterator, TSentinel>(std::move(first), std::move(last)));
+}
+}    //namespace evolutional
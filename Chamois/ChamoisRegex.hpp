@@ -0,0 +1,653 @@
+#pragma once
+
+/*
+ *    Copyright 2014 Oli Wilkinson
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *        distributed under the License is distributed on an "AS IS" BASIS,
+ *        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *        See the License for the specific language governing permissions and
+ *        limitations under the License.
+ *
+ *    Then modified by Smurf-IV from 2022-12-12 onwards
+ *    https://github.com/Smurf-IV/FluentAssertions-for-Cpp/commits/master
+ *    Current date is 2023-06-14
+ */
+
+// Opt-in regular expression assertions for `That(string)`: `MatchRegex`, `NotMatchRegex` and `ContainMatch`;
+// also included by Chamois.hpp.
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <regex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "ChamoisCore.hpp"
+#include "ChamoisStrings.hpp"
+
+/// How many compiled patterns are kept, for each character type; a pattern that hashes to a taken slot replaces the
+/// one there
+#ifndef CHAMOIS_REGEX_CACHE_SIZE
+#define CHAMOIS_REGEX_CACHE_SIZE 64
+#endif
+
+namespace evolutional
+{
+namespace detail
+{
+///
+/// The bytes a character class matches, one bit each
+class ByteSet
+{
+public:
+    void Add(const unsigned char byte) noexcept
+    {
+        m_bits[byte / 64] |= std::uint64_t{ 1 } << (byte % 64);
+    }
+
+    void Add(const unsigned char first, const unsigned char last) noexcept
+    {
+        for (unsigned byte = first; byte <= last; ++byte)
+        {
+            Add(static_cast<unsigned char>(byte));
+        }
+    }
+
+    void Add(const ByteSet& other) noexcept
+    {
+        for (size_t i = 0; i < m_bits.size(); ++i)
+        {
+            m_bits[i] |= other.m_bits[i];
+        }
+    }
+
+    void Remove(const unsigned char byte) noexcept
+    {
+        m_bits[byte / 64] &= ~(std::uint64_t{ 1 } << (byte % 64));
+    }
+
+    void Invert() noexcept
+    {
+        for (std::uint64_t& bits : m_bits)
+        {
+            bits = ~bits;
+        }
+    }
+
+    [[nodiscard]] bool Has(const unsigned char byte) const noexcept
+    {
+        return (m_bits[byte / 64] >> (byte % 64) & 1) != 0;
+    }
+
+    /// Whether the set is one byte, which is then stored in `byte`
+    [[nodiscard]] bool Single(unsigned char& byte) const noexcept
+    {
+        size_t count = 0;
+        for (unsigned candidate = 0; candidate < 256; ++candidate)
+        {
+            if (Has(static_cast<unsigned char>(candidate)))
+            {
+                byte = static_cast<unsigned char>(candidate);
+                ++count;
+            }
+        }
+        return count == 1;
+    }
+
+private:
+    std::array<std::uint64_t, 4> m_bits{};
+};
+
+///
+/// A pattern that is a sequence of character classes, each matched once, optionally (`?`), repeatedly (`+`), both
+/// (`*`) or a number of times (`{m,n}`), as most patterns in tests are: `\d{4}-\d{2}-\d{2} ERROR: .* timed out`.
+/// Matched with one bit for each position of the pattern, a byte at a time (Shift-And), where std::regex backtracks.
+/// Only patterns that mean the same here as in ECMAScript are taken; everything else is left to std::regex
+class ClassSequence
+{
+public:
+    // A pattern longer than this (after `{m,n}` is written out) is left to std::regex
+    static constexpr size_t MaxPositions = 63;
+
+    /// Whether `pattern` is a sequence of character classes, which is then what this matches
+    [[nodiscard]] bool Parse(const std::string_view pattern)
+    {
+        size_t i = 0;
+        if (i < pattern.length() && pattern[i] == '^')
+        {
+            m_anchored_start = true;
+            ++i;
+        }
+        while (i < pattern.length())
+        {
+            if (pattern[i] == '$' && i + 1 == pattern.length())
+            {
+                m_anchored_end = true;
+                break;
+            }
+            ByteSet atom;
+            if (!ParseAtom(pattern, i, atom))
+            {
+                return false;
+            }
+            size_t min = 1;
+            size_t max = 1;
+            if (i < pattern.length() && (pattern[i] == '*' || pattern[i] == '+' || pattern[i] == '?' || pattern[i] == '{'))
+            {
+                if (!ParseQuantifier(pattern, i, min, max))
+                {
+                    return false;
+                }
+                // Lazy or greedy, whether there is a match is the same
+                if (i < pattern.length() && pattern[i] == '?')
+                {
+                    ++i;
+                }
+            }
+            if (!AddAtom(atom, min, max))
+            {
+                return false;
+            }
+        }
+        m_final = std::uint64_t{ 1 } << m_positions;
+        for (size_t position = 0, run = 0; position < m_positions; ++position)
+        {
+            run = (m_optional >> position & 1) != 0 ? run + 1 : 0;
+            m_optional_run = run > m_optional_run ? run : m_optional_run;
+        }
+        m_initial = Close(1);
+        m_literal = m_literal && !m_anchored_start && !m_anchored_end;
+        return true;
+    }
+
+    /// The characters to look for, when every class is one character matched once and there are no anchors
+    [[nodiscard]] const std::string* Literal() const noexcept
+    {
+        return m_literal ? &m_text : nullptr;
+    }
+
+    /// Whether the whole of `text` matches
+    [[nodiscard]] bool Matches(const std::string_view text) const noexcept
+    {
+        std::uint64_t states = m_initial;
+        for (const char c : text)
+        {
+            states = Step(states, static_cast<unsigned char>(c));
+            if (states == 0)
+            {
+                return false;
+            }
+        }
+        return (states & m_final) != 0;
+    }
+
+    /// Whether some of `text` matches
+    [[nodiscard]] bool Search(const std::string_view text) const noexcept
+    {
+        std::uint64_t states = m_initial;
+        if (!m_anchored_end && (states & m_final) != 0)
+        {
+            return true;
+        }
+        for (const char c : text)
+        {
+            states = Step(states, static_cast<unsigned char>(c));
+            if (!m_anchored_start)
+            {
+                states |= m_initial;
+            }
+            else if (states == 0)
+            {
+                return false;
+            }
+            if (!m_anchored_end && (states & m_final) != 0)
+            {
+                return true;
+            }
+        }
+        return (states & m_final) != 0;
+    }
+
+private:
+    // Bit i of the states is set when the first i positions have matched
+    std::uint64_t Step(const std::uint64_t states, const unsigned char byte) const noexcept
+    {
+        return Close(((states << 1) | (states & m_repeat)) & m_classes[byte]);
+    }
+
+    // Also sets the bits reached by skipping optional positions
+    std::uint64_t Close(std::uint64_t states) const noexcept
+    {
+        for (size_t i = 0; i < m_optional_run; ++i)
+        {
+            states |= (states & m_optional) << 1;
+        }
+        return states;
+    }
+
+    static bool ParseAtom(const std::string_view pattern, size_t& i, ByteSet& atom)
+    {
+        switch (pattern[i])
+        {
+        case '.':
+            // Anything but a line terminator
+            atom.Add(0, 255);
+            atom.Remove('\n');
+            atom.Remove('\r');
+            ++i;
+            return true;
+        case '\\':
+            return ParseEscape(pattern, i, atom);
+        case '[':
+            return ParseClass(pattern, i, atom);
+        case '(':
+        case ')':
+        case '|':
+        case '^':
+        case '$':
+        case '*':
+        case '+':
+        case '?':
+        case '{':
+        case '}':
+        case ']':
+            return false;
+        default:
+            atom.Add(static_cast<unsigned char>(pattern[i++]));
+            return true;
+        }
+    }
+
+    // `\d`, `\w`, `\s`, their complements, control characters and escaped punctuation, as in the "C" locale
+    static bool ParseEscape(const std::string_view pattern, size_t& i, ByteSet& atom)
+    {
+        if (i + 1 == pattern.length())
+        {
+            return false;
+        }
+        const char escaped = pattern[i + 1];
+        i += 2;
+        ByteSet set;
+        switch (escaped)
+        {
+        case 'd':
+        case 'D':
+            set.Add('0', '9');
+            break;
+        case 'w':
+        case 'W':
+            set.Add('0', '9');
+            set.Add('A', 'Z');
+            set.Add('a', 'z');
+            set.Add('_');
+            break;
+        case 's':
+        case 'S':
+            set.Add(' ');
+            set.Add('\t', '\r');
+            break;
+        case 'n':
+            set.Add('\n');
+            break;
+        case 'r':
+            set.Add('\r');
+            break;
+        case 't':
+            set.Add('\t');
+            break;
+        case 'f':
+            set.Add('\f');
+            break;
+        case 'v':
+            set.Add('\v');
+            break;
+        default:
+            if (std::string_view("^$\\.*+?()[]{}|/-").find(escaped) == std::string_view::npos)
+            {
+                // Back references, word boundaries, \x, \u, \c and the like
+                return false;
+            }
+            set.Add(static_cast<unsigned char>(escaped));
+            break;
+        }
+        if (escaped == 'D' || escaped == 'W' || escaped == 'S')
+        {
+            set.Invert();
+        }
+        atom.Add(set);
+        return true;
+    }
+
+    // `[...]` and `[^...]` of ASCII characters, ranges of them and escapes
+    static bool ParseClass(const std::string_view pattern, size_t& i, ByteSet& atom)
+    {
+        ++i;
+        const bool negated = i < pattern.length() && pattern[i] == '^';
+        i += negated ? 1 : 0;
+        if (i < pattern.length() && pattern[i] == ']')
+        {
+            return false;
+        }
+        ByteSet set;
+        while (i < pattern.length() && pattern[i] != ']')
+        {
+            const auto first = static_cast<unsigned char>(pattern[i]);
+            if (first == '\\')
+            {
+                // An escape is not taken as the end of a range
+                if (!ParseEscape(pattern, i, set) ||
+                    (i + 1 < pattern.length() && pattern[i] == '-' && pattern[i + 1] != ']'))
+                {
+                    return false;
+                }
+                continue;
+            }
+            // Ranges of non ASCII characters depend on the locale, and `[:alpha:]` and the like are not parsed here
+            if (first >= 0x80 ||
+                (first == '[' && i + 1 < pattern.length() && std::string_view(":=.").find(pattern[i + 1]) != std::string_view::npos))
+            {
+                return false;
+            }
+            if (i + 2 < pattern.length() && pattern[i + 1] == '-' && pattern[i + 2] != ']')
+            {
+                const auto last = static_cast<unsigned char>(pattern[i + 2]);
+                if (last == '\\' || last == '[' || last >= 0x80 || last < first)
+                {
+                    return false;
+                }
+                set.Add(first, last);
+                i += 3;
+                continue;
+            }
+            set.Add(first);
+            ++i;
+        }
+        if (i == pattern.length())
+        {
+            return false;
+        }
+        ++i;
+        if (negated)
+        {
+            set.Invert();
+        }
+        atom.Add(set);
+        return true;
+    }
+
+    // `*`, `+`, `?`, `{n}`, `{m,}` or `{m,n}`; `max` is Unbounded for the first two and `{m,}`
+    static bool ParseQuantifier(const std::string_view pattern, size_t& i, size_t& min, size_t& max)
+    {
+        switch (pattern[i++])
+        {
+        case '*':
+            min = 0;
+            max = Unbounded;
+            return true;
+        case '+':
+            min = 1;
+            max = Unbounded;
+            return true;
+        case '?':
+            min = 0;
+            max = 1;
+            return true;
+        default:
+            break;
+        }
+        if (!ParseCount(pattern, i, min))
+        {
+            return false;
+        }
+        max = min;
+        if (i < pattern.length() && pattern[i] == ',')
+        {
+            ++i;
+            max = Unbounded;
+            if (i < pattern.length() && pattern[i] != '}' && (!ParseCount(pattern, i, max) || max < min))
+            {
+                return false;
+            }
+        }
+        return i < pattern.length() && pattern[i++] == '}';
+    }
+
+    static bool ParseCount(const std::string_view pattern, size_t& i, size_t& count)
+    {
+        const size_t start = i;
+        for (count = 0; i < pattern.length() && pattern[i] >= '0' && pattern[i] <= '9' && count <= MaxPositions; ++i)
+        {
+            count = count * 10 + static_cast<size_t>(pattern[i] - '0');
+        }
+        return i > start && count <= MaxPositions;
+    }
+
+    // Writes `{m,n}` out as m positions followed by n - m optional ones, and `{m,}` as m followed by a `*`
+    bool AddAtom(const ByteSet& atom, const size_t min, const size_t max)
+    {
+        const size_t added = max == Unbounded ? (min == 0 ? 1 : min) : max;
+        if (m_positions + added > MaxPositions)
+        {
+            return false;
+        }
+        unsigned char byte = 0;
+        m_literal = m_literal && min == 1 && max == 1 && atom.Single(byte);
+        m_text += static_cast<char>(byte);
+        for (size_t copy = 0; copy < added; ++copy)
+        {
+            const std::uint64_t bit = std::uint64_t{ 1 } << (m_positions + 1);
+            for (unsigned candidate = 0; candidate < 256; ++candidate)
+            {
+                if (atom.Has(static_cast<unsigned char>(candidate)))
+                {
+                    m_classes[candidate] |= bit;
+                }
+            }
+            if (copy >= min)
+            {
+                m_optional |= bit >> 1;
+            }
+            if (max == Unbounded && copy + 1 == added)
+            {
+                m_repeat |= bit;
+            }
+            ++m_positions;
+        }
+        return true;
+    }
+
+    static constexpr size_t Unbounded = ~size_t{ 0 };
+
+    std::array<std::uint64_t, 256> m_classes{};
+    std::uint64_t m_repeat = 0;
+    std::uint64_t m_optional = 0;
+    std::uint64_t m_initial = 0;
+    std::uint64_t m_final = 0;
+    size_t m_positions = 0;
+    size_t m_optional_run = 0;
+    bool m_anchored_start = false;
+    bool m_anchored_end = false;
+    bool m_literal = true;
+    std::string m_text;
+};
+
+///
+/// A pattern compiled once: to a ClassSequence when it is one and the strings are narrow, otherwise to a std::regex
+template <typename CharT> class CompiledRegex
+{
+public:
+    using view_type = std::basic_string_view<CharT>;
+
+    explicit CompiledRegex(const view_type pattern)
+        : m_pattern(pattern)
+    {
+        if constexpr (std::is_same_v<CharT, char>)
+        {
+            m_sequence = std::make_unique<ClassSequence>();
+            if (!m_sequence->Parse(pattern))
+            {
+                m_sequence.reset();
+            }
+        }
+        if (m_sequence == nullptr)
+        {
+            try
+            {
+                m_regex.assign(m_pattern, std::regex_constants::ECMAScript | std::regex_constants::optimize);
+            }
+            catch (const std::regex_error& error)
+            {
+                m_error = error.what();
+            }
+        }
+    }
+
+    [[nodiscard]] view_type Pattern() const noexcept
+    {
+        return m_pattern;
+    }
+
+    /// Why std::regex would not compile the pattern, empty when it did
+    [[nodiscard]] const std::string& Error() const noexcept
+    {
+        return m_error;
+    }
+
+    /// Whether the whole of `text` matches
+    [[nodiscard]] bool Matches(const view_type text) const
+    {
+        if constexpr (std::is_same_v<CharT, char>)
+        {
+            if (m_sequence != nullptr)
+            {
+                const std::string* literal = m_sequence->Literal();
+                return literal != nullptr ? text == *literal : m_sequence->Matches(text);
+            }
+        }
+        return std::regex_match(text.data(), text.data() + text.length(), m_regex);
+    }
+
+    /// Whether some of `text` matches
+    [[nodiscard]] bool Search(const view_type text) const
+    {
+        if constexpr (std::is_same_v<CharT, char>)
+        {
+            if (m_sequence != nullptr)
+            {
+                const std::string* literal = m_sequence->Literal();
+                return literal != nullptr ? FindSubstring(text, view_type(*literal)) != view_type::npos
+                                          : m_sequence->Search(text);
+            }
+        }
+        return std::regex_search(text.data(), text.data() + text.length(), m_regex);
+    }
+
+private:
+    std::basic_string<CharT> m_pattern;
+    std::unique_ptr<ClassSequence> m_sequence;
+    std::basic_regex<CharT> m_regex;
+    std::string m_error;
+};
+
+///
+/// `pattern` compiled, from the cache when it was compiled before.
+/// The cache is shared by every call site and thread: a table of CHAMOIS_REGEX_CACHE_SIZE slots, chosen by the hash
+/// of the pattern, behind a mutex that is only held to look a slot up or fill it, never to compile or match
+template <typename CharT> std::shared_ptr<const CompiledRegex<CharT>> CompileRegex(const std::basic_string_view<CharT> pattern)
+{
+    static std::mutex mutex;
+    static std::array<std::shared_ptr<const CompiledRegex<CharT>>, CHAMOIS_REGEX_CACHE_SIZE> cache;
+    auto& slot = cache[std::hash<std::basic_string_view<CharT>>{}(pattern) % cache.size()];
+    {
+        const std::lock_guard<std::mutex> lock(mutex);
+        if (slot != nullptr && slot->Pattern() == pattern)
+        {
+            return slot;
+        }
+    }
+    // Two threads may both compile a pattern that is not cached yet; either copy will do
+    auto compiled = std::make_shared<const CompiledRegex<CharT>>(pattern);
+    const std::lock_guard<std::mutex> lock(mutex);
+    slot = compiled;
+    return compiled;
+}
+
+///
+/// Failure path only
+template <typename CharT> std::string DescribeRegex(const CompiledRegex<CharT>& regex)
+{
+    return "the regular expression " + Describe(regex.Pattern());
+}
+
+///
+/// Failure path only
+template <typename CharT> std::string DescribeInvalidRegex(const CompiledRegex<CharT>& regex)
+{
+    return "The regular expression " + Describe(regex.Pattern()) + " is not valid: " + regex.Error();
+}
+}    // namespace detail
+
+template <class TAssertImpl, class T, typename TStorage>
+void detail::ShouldStrImpl<TAssertImpl, T, TStorage>::_matchRegexFunc(const char* file, const int line, const view_type pattern,
+    const std::string_view because) const
+{
+    const auto regex = CompileRegex(pattern);
+    if (!regex->Error().empty())
+    {
+        TAssertImpl::AssertFail(FailureContext(file, line, because)
+                                    .WithReason(DescribeInvalidRegex(*regex)));
+    }
+    else if (!regex->Matches(m_value))
+    {
+        TAssertImpl::AssertFail(FailureContext(file, line, because)
+                                    .WithReason(DescribeHaystack(m_value) + " does not match " + DescribeRegex(*regex)));
+    }
+}
+
+template <class TAssertImpl, class T, typename TStorage>
+void detail::ShouldStrImpl<TAssertImpl, T, TStorage>::_notMatchRegexFunc(const char* file, const int line,
+    const view_type pattern, const std::string_view because) const
+{
+    const auto regex = CompileRegex(pattern);
+    if (!regex->Error().empty())
+    {
+        TAssertImpl::AssertFail(FailureContext(file, line, because)
+                                    .WithReason(DescribeInvalidRegex(*regex)));
+    }
+    else if (regex->Matches(m_value))
+    {
+        TAssertImpl::AssertFail(FailureContext(file, line, because)
+                                    .WithReason(DescribeHaystack(m_value) + " matches " + DescribeRegex(*regex)));
+    }
+}
+
+template <class TAssertImpl, class T, typename TStorage>
+void detail::ShouldStrImpl<TAssertImpl, T, TStorage>::_containMatchFunc(const char* file, const int line, const view_type pattern,
+    const std::string_view because) const
+{
+    const auto regex = CompileRegex(pattern);
+    if (!regex->Error().empty())
+    {
+        TAssertImpl::AssertFail(FailureContext(file, line, because)
+                                    .WithReason(DescribeInvalidRegex(*regex)));
+    }
+    else if (!regex->Search(m_value))
+    {
+        TAssertImpl::AssertFail(FailureContext(file, line, because)
+                                    .WithReason(DescribeHaystack(m_value) + " contains no match of " +
+                                        DescribeRegex(*regex)));
+    }
+}
+}    //namespace evolutional
@@ -0,0 +1,305 @@
+#pragma once
+
+/*
+ *    Copyright 2014 Oli Wilkinson
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *        distributed under the License is distributed on an "AS IS" BASIS,
+ *        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *        See the License for the specific language governing permissions and
+ *        limitations under the License.
+ *
+ *    Then modified by Smurf-IV from 2022-12-12 onwards
+ *    https://github.com/Smurf-IV/FluentAssertions-for-Cpp/commits/master
+ *    Current date is 2023-06-14
+ */
+
+// Opt-in `AssertionScope` (soft assertions) and `ThreadAssertionScope`; also included by Chamois.hpp.
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory_resource>
+#include <source_location>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ChamoisCore.hpp"
+
+namespace evolutional
+{
+namespace detail
+{
+///
+/// Appends "file(line):" and then each line of the reason, the description and the `because`, indented
+template <class TString>
+void AppendFailure(TString& failure, const FailureContext& context, const std::string_view description)
+{
+    failure.append(context.file()).append("(").append(std::to_string(context.line())).append("):");
+    for (const std::string_view part : { context.reason(), description, context.because() })
+    {
+        for (std::size_t start = 0; start < part.length();)
+        {
+            const std::size_t newline = part.find('\n', start);
+            const std::size_t end = newline == std::string_view::npos ? part.length() : newline;
+            failure.append("\n     ").append(part.substr(start, end - start));
+            start = end + 1;
+        }
+    }
+}
+
+///
+/// "N assertion failures <where>:" followed by the numbered failures
+template <class TFailures>
+std::string AggregateFailures(const TFailures& failures, const std::string_view where)
+{
+    std::string aggregate = std::to_string(failures.size()) +
+        (failures.size() == 1 ? " assertion failure " : " assertion failures ");
+    aggregate.append(where).append(":");
+    std::size_t number = 0;
+    for (const auto& failure : failures)
+    {
+        aggregate.append("\n  ").append(std::to_string(++number)).append(") ").append(failure);
+    }
+    return aggregate;
+}
+
+///
+/// The failures of the threads that have no collector of their own, while a `ThreadAssertionScope` is alive.
+/// Workers push onto a lock-free stack, the test thread takes the lot at once.
+/// There is only the one, which lives until the program ends, so a late worker can never push into a destroyed scope.
+class WorkerFailureQueue final : public FailureCollector
+{
+public:
+    [[nodiscard]] static WorkerFailureQueue& Instance()
+    {
+        static WorkerFailureQueue queue;
+        return queue;
+    }
+
+    ~WorkerFailureQueue()
+    {
+        (void)Drain();
+    }
+
+    void Collect(const FailureContext& context, const std::string_view description) override
+    {
+        auto* node = new Node();  // NOLINT(cppcoreguidelines-owning-memory)
+        AppendFailure(node->failure, context, description);
+        node->next = m_head.load(std::memory_order_relaxed);
+        while (!m_head.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    /// Everything collected so far, oldest first
+    [[nodiscard]] std::vector<std::string> Drain()
+    {
+        Node* newest = m_head.exchange(nullptr, std::memory_order_acquire);
+        Node* oldest = nullptr;
+        while (newest != nullptr)
+        {
+            oldest = std::exchange(newest, std::exchange(newest->next, oldest));
+        }
+        std::vector<std::string> failures;
+        while (oldest != nullptr)
+        {
+            failures.push_back(std::move(oldest->failure));
+            delete std::exchange(oldest, oldest->next);  // NOLINT(cppcoreguidelines-owning-memory)
+        }
+        return failures;
+    }
+
+private:
+    WorkerFailureQueue() = default;
+
+    struct Node
+    {
+        std::string failure;
+        Node* next = nullptr;
+    };
+
+    std::atomic<Node*> m_head{ nullptr };
+};
+}
+
+///
+/// While in scope, failing assertions on this thread are collected instead of stopping the test,
+/// and are reported to the backend together, as one failure, when the scope ends:
+///
+///     {
+///         AssertionScope scope;
+///         Assert::That(order.count()).Should().Be(3);
+///         Assert::That(order.total()).Should().Be(30);
+///     }   // Reports both, if both fail
+///
+/// Once `max_failures` have been collected they are reported straight away, so a runaway loop stops early.
+/// A scope inside another reports its failures to the outer scope rather than to the backend.
+/// Failures are kept in an arena that starts out inside the scope object, so the first few do not allocate.
+class AssertionScope final : public detail::FailureCollector
+{
+public:
+    static constexpr std::size_t DefaultMaxFailures = 10;
+
+    explicit AssertionScope(const std::size_t max_failures = DefaultMaxFailures,
+        const std::source_location location = std::source_location::current())
+        : m_file(location.file_name()), m_line(static_cast<int>(location.line())),
+        m_max_failures(max_failures > 0 ? max_failures : 1), m_uncaught_exceptions(std::uncaught_exceptions()),
+        m_previous(Current())
+    {
+        Current() = this;
+    }
+
+    AssertionScope(AssertionScope&&) = delete;
+    AssertionScope& operator=(AssertionScope&&) = delete;
+
+    /// Reports the collected failures, unless the scope is being left by an exception, when they go to stderr instead
+    ~AssertionScope() noexcept(false)
+    {
+        if (!Deactivate() || m_failures.empty())
+        {
+            return;
+        }
+        if (std::uncaught_exceptions() > m_uncaught_exceptions)
+        {
+            std::fputs((Aggregate() + "\n").c_str(), stderr);
+            return;
+        }
+        ReportAggregate();
+    }
+
+    [[nodiscard]] std::size_t FailureCount() const noexcept
+    {
+        return m_failures.size();
+    }
+
+    /// The collected failures as they would have been reported; they are then forgotten, and will not fail the test
+    [[nodiscard]] std::string Discard()
+    {
+        auto aggregate = m_failures.empty() ? std::string() : Aggregate();
+        Forget();
+        return aggregate;
+    }
+
+    void Collect(const detail::FailureContext& context, const std::string_view description) override
+    {
+        detail::AppendFailure(m_failures.emplace_back(), context, description);
+        if (m_failures.size() >= m_max_failures && Deactivate())
+        {
+            ReportAggregate();
+        }
+    }
+
+private:
+    /// Stops collecting, returns false if it already had
+    bool Deactivate() noexcept
+    {
+        if (!m_active)
+        {
+            return false;
+        }
+        Current() = m_previous;
+        m_active = false;
+        return true;
+    }
+
+    [[nodiscard]] std::string Aggregate() const
+    {
+        return detail::AggregateFailures(m_failures, "in scope");
+    }
+
+    // Clearing keeps the vector's storage and the arena never frees, so the failures are dropped with the storage,
+    // and the arena then gives back everything it took beyond the inline buffer
+    void Forget()
+    {
+        m_failures = std::pmr::vector<std::pmr::string>(&m_arena);
+        m_arena.release();
+    }
+
+    void ReportAggregate()
+    {
+        const std::string aggregate = Aggregate();
+        Forget();
+        detail::AssertInternal::AssertFail(detail::FailureContext(m_file, m_line, {}, aggregate));
+    }
+
+    const char* m_file;
+    int m_line;
+    std::size_t m_max_failures;
+    int m_uncaught_exceptions;
+    FailureCollector* m_previous;
+    bool m_active = true;
+    std::array<std::byte, 1024> m_buffer;
+    std::pmr::monotonic_buffer_resource m_arena{ m_buffer.data(), m_buffer.size() };
+    std::pmr::vector<std::pmr::string> m_failures{ &m_arena };
+};
+
+///
+/// While in scope, failing assertions on any other thread that has no `AssertionScope` of its own are queued instead
+/// of reaching a backend that is not safe to use from there, and are reported on this thread, as one failure that
+/// keeps the file and line of each, by `Join()` or when the scope ends:
+///
+///     ThreadAssertionScope threads;
+///     std::thread worker([] { Assert::That(Compute()).Should().Be(42); });
+///     worker.join();
+///     threads.Join();  // Reports the failure on the worker here
+///
+/// Failures on this thread are reported as usual. Join the workers first, a failure queued after `Join()` is only
+/// reported by the next one, or at the end of the scope.
+class ThreadAssertionScope final
+{
+public:
+    explicit ThreadAssertionScope(const std::source_location location = std::source_location::current())
+        : m_file(location.file_name()), m_line(static_cast<int>(location.line())),
+        m_uncaught_exceptions(std::uncaught_exceptions()),
+        m_previous(detail::FailureCollector::ForOtherThreads().exchange(&detail::WorkerFailureQueue::Instance(),
+            std::memory_order_acq_rel)),
+        m_previous_owner(detail::FailureCollector::OwnsForOtherThreads())
+    {
+        detail::FailureCollector::OwnsForOtherThreads() = true;
+    }
+
+    ThreadAssertionScope(const ThreadAssertionScope&) = delete;
+    ThreadAssertionScope& operator=(const ThreadAssertionScope&) = delete;
+
+    /// Reports the queued failures, unless the scope is being left by an exception, when they go to stderr instead
+    ~ThreadAssertionScope() noexcept(false)
+    {
+        detail::FailureCollector::ForOtherThreads().store(m_previous, std::memory_order_release);
+        detail::FailureCollector::OwnsForOtherThreads() = m_previous_owner;
+        if (std::uncaught_exceptions() > m_uncaught_exceptions)
+        {
+            if (const auto failures = detail::WorkerFailureQueue::Instance().Drain(); !failures.empty())
+            {
+                std::fputs((detail::AggregateFailures(failures, "on other threads") + "\n").c_str(), stderr);
+            }
+            return;
+        }
+        Join();
+    }
+
+    /// Reports the failures queued so far, on this thread; call it once the workers have been joined
+    void Join()
+    {
+        if (const auto failures = detail::WorkerFailureQueue::Instance().Drain(); !failures.empty())
+        {
+            const std::string aggregate = detail::AggregateFailures(failures, "on other threads");
+            detail::AssertInternal::AssertFail(detail::FailureContext(m_file, m_line, {}, aggregate));
+        }
+    }
+
+private:
+    const char* m_file;
+    int m_line;
+    int m_uncaught_exceptions;
+    detail::FailureCollector* m_previous;
+    bool m_previous_owner;
+};
+}
@@ -0,0 +1,336 @@
+#pragma once
+
+/*
+ *    Copyright 2014 Oli Wilkinson
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *        distributed under the License is distributed on an "AS IS" BASIS,
+ *        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *        See the License for the specific language governing permissions and
+ *        limitations under the License.
+ *
+ *    Then modified by Smurf-IV from 2022-12-12 onwards
+ *    https://github.com/Smurf-IV/FluentAssertions-for-Cpp/commits/master
+ *    Current date is 2023-06-14
+ */
+
+// The byte search kernels behind the array, string and file comparisons, included by ChamoisCore.hpp.
+// On x86 they look at 16 or 32 bytes at a time (AVX2 is picked at runtime). GCC and Clang write the 16 and 32 byte
+// vectors with their vector extensions, as <immintrin.h> alone is some 40,000 lines; only MSVC includes it.
+// Define CHAMOIS_NO_SIMD to compare one byte at a time everywhere
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if !defined(CHAMOIS_NO_SIMD) && (defined(__x86_64__) || defined(_M_X64) || (defined(__i386__) && defined(__SSE2__)))
+#define CHAMOIS_SIMD_X86 1
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <immintrin.h>
+#include <intrin.h>
+#define CHAMOIS_TARGET_AVX2
+#else
+#define CHAMOIS_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace evolutional
+{
+namespace detail
+{
+#ifdef CHAMOIS_SIMD_X86
+// 16 and 32 bytes, compared as signed bytes as SSE2 does; a comparison gives all bits set in each byte where it holds
+#if defined(_MSC_VER) && !defined(__clang__)
+using Bytes16 = __m128i;
+using Bytes32 = __m256i;
+
+inline Bytes16 Load16(const unsigned char* bytes) noexcept
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes));
+}
+inline Bytes16 Splat16(const unsigned char byte) noexcept
+{
+    return _mm_set1_epi8(static_cast<char>(byte));
+}
+inline Bytes16 Equal(const Bytes16 lhs, const Bytes16 rhs) noexcept
+{
+    return _mm_cmpeq_epi8(lhs, rhs);
+}
+inline Bytes16 Greater(const Bytes16 lhs, const Bytes16 rhs) noexcept
+{
+    return _mm_cmpgt_epi8(lhs, rhs);
+}
+inline Bytes16 And(const Bytes16 lhs, const Bytes16 rhs) noexcept
+{
+    return _mm_and_si128(lhs, rhs);
+}
+inline Bytes16 Or(const Bytes16 lhs, const Bytes16 rhs) noexcept
+{
+    return _mm_or_si128(lhs, rhs);
+}
+/// A bit for each byte, its top one
+inline std::uint32_t Mask(const Bytes16 bytes) noexcept
+{
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(bytes));
+}
+
+inline Bytes32 Load32(const unsigned char* bytes) noexcept
+{
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes));
+}
+inline Bytes32 Splat32(const unsigned char byte) noexcept
+{
+    return _mm256_set1_epi8(static_cast<char>(byte));
+}
+inline Bytes32 Equal(const Bytes32 lhs, const Bytes32 rhs) noexcept
+{
+    return _mm256_cmpeq_epi8(lhs, rhs);
+}
+inline Bytes32 Greater(const Bytes32 lhs, const Bytes32 rhs) noexcept
+{
+    return _mm256_cmpgt_epi8(lhs, rhs);
+}
+inline Bytes32 And(const Bytes32 lhs, const Bytes32 rhs) noexcept
+{
+    return _mm256_and_si256(lhs, rhs);
+}
+inline Bytes32 Or(const Bytes32 lhs, const Bytes32 rhs) noexcept
+{
+    return _mm256_or_si256(lhs, rhs);
+}
+inline std::uint32_t Mask(const Bytes32 bytes) noexcept
+{
+    return static_cast<std::uint32_t>(_mm256_movemask_epi8(bytes));
+}
+#else
+using Bytes16 = signed char __attribute__((vector_size(16)));
+using Bytes32 = signed char __attribute__((vector_size(32)));
+// The type the movemask builtins take
+using Chars16 = char __attribute__((vector_size(16)));
+using Chars32 = char __attribute__((vector_size(32)));
+
+inline Bytes16 Load16(const unsigned char* bytes) noexcept
+{
+    Bytes16 loaded;
+    std::memcpy(&loaded, bytes, sizeof(loaded));
+    return loaded;
+}
+inline Bytes16 Splat16(const unsigned char byte) noexcept
+{
+    return Bytes16{} + static_cast<signed char>(byte);
+}
+inline Bytes16 Equal(const Bytes16 lhs, const Bytes16 rhs) noexcept
+{
+    return lhs == rhs;
+}
+inline Bytes16 Greater(const Bytes16 lhs, const Bytes16 rhs) noexcept
+{
+    return lhs > rhs;
+}
+inline Bytes16 And(const Bytes16 lhs, const Bytes16 rhs) noexcept
+{
+    return lhs & rhs;
+}
+inline Bytes16 Or(const Bytes16 lhs, const Bytes16 rhs) noexcept
+{
+    return lhs | rhs;
+}
+/// A bit for each byte, its top one
+inline std::uint32_t Mask(const Bytes16 bytes) noexcept
+{
+    return static_cast<std::uint32_t>(__builtin_ia32_pmovmskb128((Chars16)bytes));
+}
+
+CHAMOIS_TARGET_AVX2 inline Bytes32 Load32(const unsigned char* bytes) noexcept
+{
+    Bytes32 loaded;
+    std::memcpy(&loaded, bytes, sizeof(loaded));
+    return loaded;
+}
+CHAMOIS_TARGET_AVX2 inline Bytes32 Splat32(const unsigned char byte) noexcept
+{
+    return Bytes32{} + static_cast<signed char>(byte);
+}
+CHAMOIS_TARGET_AVX2 inline Bytes32 Equal(const Bytes32 lhs, const Bytes32 rhs) noexcept
+{
+    return lhs == rhs;
+}
+CHAMOIS_TARGET_AVX2 inline Bytes32 Greater(const Bytes32 lhs, const Bytes32 rhs) noexcept
+{
+    return lhs > rhs;
+}
+CHAMOIS_TARGET_AVX2 inline Bytes32 And(const Bytes32 lhs, const Bytes32 rhs) noexcept
+{
+    return lhs & rhs;
+}
+CHAMOIS_TARGET_AVX2 inline Bytes32 Or(const Bytes32 lhs, const Bytes32 rhs) noexcept
+{
+    return lhs | rhs;
+}
+CHAMOIS_TARGET_AVX2 inline std::uint32_t Mask(const Bytes32 bytes) noexcept
+{
+    return static_cast<std::uint32_t>(__builtin_ia32_pmovmskb256((Chars32)bytes));
+}
+#endif
+
+inline bool HasAvx2() noexcept
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    int registers[4];
+    __cpuid(registers, 0);
+    if (registers[0] < 7)
+    {
+        return false;
+    }
+    __cpuid(registers, 1);
+    // The OS must save the YMM registers as well (OSXSAVE, then XCR0 bits 1 and 2)
+    if ((registers[2] & (1 << 27)) == 0 || (_xgetbv(0) & 0x6) != 0x6)
+    {
+        return false;
+    }
+    __cpuidex(registers, 7, 0);
+    return (registers[1] & (1 << 5)) != 0;
+#else
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+#endif
+
+inline size_t FirstMismatchBytesScalar(const unsigned char* lhs, const unsigned char* rhs, const size_t count) noexcept
+{
+    size_t i = 0;
+    while (i < count && lhs[i] == rhs[i])
+    {
+        ++i;
+    }
+    return i;
+}
+
+#ifdef CHAMOIS_SIMD_X86
+inline size_t FirstMismatchBytesSse2(const unsigned char* lhs, const unsigned char* rhs, const size_t count) noexcept
+{
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const std::uint32_t equal = Mask(Equal(Load16(lhs + i), Load16(rhs + i)));
+        if (equal != 0xFFFFu)
+        {
+            return i + static_cast<size_t>(std::countr_one(equal));
+        }
+    }
+    return i + FirstMismatchBytesScalar(lhs + i, rhs + i, count - i);
+}
+
+CHAMOIS_TARGET_AVX2 inline size_t FirstMismatchBytesAvx2(const unsigned char* lhs, const unsigned char* rhs,
+    const size_t count) noexcept
+{
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32)
+    {
+        const std::uint32_t equal = Mask(Equal(Load32(lhs + i), Load32(rhs + i)));
+        if (equal != 0xFFFFFFFFu)
+        {
+            return i + static_cast<size_t>(std::countr_one(equal));
+        }
+    }
+    return i + FirstMismatchBytesSse2(lhs + i, rhs + i, count - i);
+}
+#endif
+
+///
+/// The index of the first byte at which the two differ, or `count` when they do not
+inline size_t FirstMismatchBytes(const unsigned char* lhs, const unsigned char* rhs, const size_t count) noexcept
+{
+#ifdef CHAMOIS_SIMD_X86
+    static const bool avx2 = HasAvx2();
+    return avx2 ? FirstMismatchBytesAvx2(lhs, rhs, count) : FirstMismatchBytesSse2(lhs, rhs, count);
+#else
+    return FirstMismatchBytesScalar(lhs, rhs, count);
+#endif
+}
+
+// Of the bits of `equal`, one per byte, those that start a `Size` byte element whose bytes are all set
+template <size_t Size> constexpr std::uint32_t ElementMatches(std::uint32_t equal) noexcept
+{
+    for (size_t shift = 1; shift < Size; shift *= 2)
+    {
+        equal &= equal >> shift;
+    }
+    return equal & (0xFFFFFFFFu / static_cast<std::uint32_t>((std::uint64_t{ 1 } << Size) - 1));
+}
+
+template <size_t Size>
+inline size_t FindElementBytesScalar(const unsigned char* data, const size_t count, const unsigned char* value) noexcept
+{
+    size_t i = 0;
+    while (i < count && std::memcmp(data + i * Size, value, Size) != 0)
+    {
+        ++i;
+    }
+    return i;
+}
+
+#ifdef CHAMOIS_SIMD_X86
+template <size_t Size>
+inline size_t FindElementBytesSse2(const unsigned char* data, const size_t count, const unsigned char* value) noexcept
+{
+    unsigned char repeated[16];
+    for (size_t byte = 0; byte < sizeof(repeated); byte += Size)
+    {
+        std::memcpy(repeated + byte, value, Size);
+    }
+    const Bytes16 pattern = Load16(repeated);
+    size_t i = 0;
+    for (; i + 16 / Size <= count; i += 16 / Size)
+    {
+        if (const std::uint32_t matches = ElementMatches<Size>(Mask(Equal(Load16(data + i * Size), pattern))); matches != 0)
+        {
+            return i + static_cast<size_t>(std::countr_zero(matches)) / Size;
+        }
+    }
+    return i + FindElementBytesScalar<Size>(data + i * Size, count - i, value);
+}
+
+template <size_t Size>
+CHAMOIS_TARGET_AVX2 inline size_t FindElementBytesAvx2(const unsigned char* data, const size_t count,
+    const unsigned char* value) noexcept
+{
+    unsigned char repeated[32];
+    for (size_t byte = 0; byte < sizeof(repeated); byte += Size)
+    {
+        std::memcpy(repeated + byte, value, Size);
+    }
+    const Bytes32 pattern = Load32(repeated);
+    size_t i = 0;
+    for (; i + 32 / Size <= count; i += 32 / Size)
+    {
+        if (const std::uint32_t matches = ElementMatches<Size>(Mask(Equal(Load32(data + i * Size), pattern))); matches != 0)
+        {
+            return i + static_cast<size_t>(std::countr_zero(matches)) / Size;
+        }
+    }
+    return i + FindElementBytesSse2<Size>(data + i * Size, count - i, value);
+}
+#endif
+
+///
+/// The index of the first of the `count` elements of `Size` bytes that has the bytes of `value`, or `count`
+template <size_t Size>
+inline size_t FindElementBytes(const unsigned char* data, const size_t count, const unsigned char* value) noexcept
+{
+#ifdef CHAMOIS_SIMD_X86
+    static const bool avx2 = HasAvx2();
+    return avx2 ? FindElementBytesAvx2<Size>(data, count, value) : FindElementBytesSse2<Size>(data, count, value);
+#else
+    return FindElementBytesScalar<Size>(data, count, value);
+#endif
+}
+}    // namespace detail
+}    //namespace evolutional
@@ -0,0 +1,1165 @@
+#pragma once
+
+/*
+ *    Copyright 2014 Oli Wilkinson
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *        distributed under the License is distributed on an "AS IS" BASIS,
+ *        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *        See the License for the specific language governing permissions and
+ *        limitations under the License.
+ *
+ *    Then modified by Smurf-IV from 2022-12-12 onwards
+ *    https://github.com/Smurf-IV/FluentAssertions-for-Cpp/commits/master
+ *    Current date is 2023-06-14
+ */
+
+// Opt-in substring search for `That(string)`: `Contain`, `NotContain`, `ContainAll` and `ContainInOrder`, and the
+// case-insensitive `BeEquivalentToIgnoringCase`, `StartWithIgnoringCase` and `ContainIgnoringCase`, and the wildcard
+// patterns of `MatchWildcard`, `NotMatchWildcard` and `MatchWildcardIgnoringCase`; also included by Chamois.hpp.
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <initializer_list>
+#include <memory_resource>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "ChamoisCore.hpp"
+
+namespace evolutional
+{
+namespace detail
+{
+// Needles at least this long are searched for with Boyer-Moore-Horspool, which skips up to their length at a time
+constexpr size_t HorspoolLength = 32;
+
+// Up to this many needles, each is looked for with its own SIMD pass rather than all of them in one automaton pass;
+// the automaton reads a byte in about the time 20 SIMD passes do
+constexpr size_t ScannedNeedleLimit = 16;
+
+// The most states the automaton for many needles may have, at 1 KiB each
+constexpr size_t MaxSubstringStates = 4096;
+
+inline size_t FindSubstringBytesScalar(const unsigned char* haystack, const size_t count, const unsigned char* needle,
+    const size_t length) noexcept
+{
+    for (size_t i = 0; i + length <= count; ++i)
+    {
+        if (haystack[i] == needle[0] && std::memcmp(haystack + i + 1, needle + 1, length - 1) == 0)
+        {
+            return i;
+        }
+    }
+    return count;
+}
+
+#ifdef CHAMOIS_SIMD_X86
+// The first and last byte of the needle are compared with 16 positions at once, and only where both match is the
+// rest compared; text rarely has both at the right distance apart, so few positions get that far
+inline size_t FindSubstringBytesSse2(const unsigned char* haystack, const size_t count, const unsigned char* needle,
+    const size_t length) noexcept
+{
+    const Bytes16 first = Splat16(needle[0]);
+    const Bytes16 last = Splat16(needle[length - 1]);
+    size_t i = 0;
+    for (; i + length - 1 + 16 <= count; i += 16)
+    {
+        const Bytes16 starts = Load16(haystack + i);
+        const Bytes16 ends = Load16(haystack + i + length - 1);
+        auto candidates = Mask(And(Equal(starts, first), Equal(ends, last)));
+        for (; candidates != 0; candidates &= candidates - 1)
+        {
+            const size_t at = i + static_cast<size_t>(std::countr_zero(candidates));
+            if (std::memcmp(haystack + at + 1, needle + 1, length - 2) == 0)
+            {
+                return at;
+            }
+        }
+    }
+    const size_t rest = FindSubstringBytesScalar(haystack + i, count - i, needle, length);
+    return rest == count - i ? count : i + rest;
+}
+
+CHAMOIS_TARGET_AVX2 inline size_t FindSubstringBytesAvx2(const unsigned char* haystack, const size_t count,
+    const unsigned char* needle, const size_t length) noexcept
+{
+    const Bytes32 first = Splat32(needle[0]);
+    const Bytes32 last = Splat32(needle[length - 1]);
+    size_t i = 0;
+    for (; i + length - 1 + 32 <= count; i += 32)
+    {
+        const Bytes32 starts = Load32(haystack + i);
+        const Bytes32 ends = Load32(haystack + i + length - 1);
+        auto candidates = Mask(And(Equal(starts, first), Equal(ends, last)));
+        for (; candidates != 0; candidates &= candidates - 1)
+        {
+            const size_t at = i + static_cast<size_t>(std::countr_zero(candidates));
+            if (std::memcmp(haystack + at + 1, needle + 1, length - 2) == 0)
+            {
+                return at;
+            }
+        }
+    }
+    const size_t rest = FindSubstringBytesSse2(haystack + i, count - i, needle, length);
+    return rest == count - i ? count : i + rest;
+}
+#endif
+
+///
+/// The index of the first occurrence of the `length` (2 or more) bytes of `needle` in `haystack`, or `count`
+inline size_t FindSubstringBytes(const unsigned char* haystack, const size_t count, const unsigned char* needle,
+    const size_t length) noexcept
+{
+#ifdef CHAMOIS_SIMD_X86
+    static const bool avx2 = HasAvx2();
+    return avx2 ? FindSubstringBytesAvx2(haystack, count, needle, length)
+                : FindSubstringBytesSse2(haystack, count, needle, length);
+#else
+    return FindSubstringBytesScalar(haystack, count, needle, length);
+#endif
+}
+
+///
+/// Boyer-Moore-Horspool: the character under the end of the needle says how far it can move on.
+/// Wide characters share the shift table by their low byte, which only ever makes a shift shorter
+template <typename CharT>
+size_t FindSubstringHorspool(const std::basic_string_view<CharT> haystack, const std::basic_string_view<CharT> needle)
+{
+    const size_t length = needle.length();
+    size_t shifts[256];
+    for (size_t& shift : shifts)
+    {
+        shift = length;
+    }
+    for (size_t i = 0; i + 1 < length; ++i)
+    {
+        shifts[static_cast<std::make_unsigned_t<CharT>>(needle[i]) & 0xFF] = length - 1 - i;
+    }
+    for (size_t i = 0; i + length <= haystack.length();)
+    {
+        const CharT last = haystack[i + length - 1];
+        if (last == needle[length - 1] && haystack.compare(i, length - 1, needle, 0, length - 1) == 0)
+        {
+            return i;
+        }
+        i += shifts[static_cast<std::make_unsigned_t<CharT>>(last) & 0xFF];
+    }
+    return std::basic_string_view<CharT>::npos;
+}
+
+///
+/// The index of the first occurrence of `needle` in `haystack` from `from` on, or npos
+template <typename CharT>
+size_t FindSubstring(const std::basic_string_view<CharT> haystack, const std::basic_string_view<CharT> needle,
+    const size_t from = 0)
+{
+    constexpr size_t npos = std::basic_string_view<CharT>::npos;
+    if (from > haystack.length() || needle.length() > haystack.length() - from)
+    {
+        return npos;
+    }
+    const std::basic_string_view<CharT> rest = haystack.substr(from);
+    size_t at = npos;
+    if (needle.empty())
+    {
+        at = 0;
+    }
+    else if (needle.length() == 1)
+    {
+        at = FindElement(rest.data(), rest.length(), needle[0]);
+        at = at == rest.length() ? npos : at;
+    }
+    else if (needle.length() >= HorspoolLength)
+    {
+        at = FindSubstringHorspool(rest, needle);
+    }
+    else if constexpr (sizeof(CharT) == 1)
+    {
+        at = FindSubstringBytes(reinterpret_cast<const unsigned char*>(rest.data()), rest.length(),
+            reinterpret_cast<const unsigned char*>(needle.data()), needle.length());
+        at = at == rest.length() ? npos : at;
+    }
+    else
+    {
+        // Wide characters: a SIMD pass to each occurrence of the first one, then the rest compared
+        for (size_t i = 0; i + needle.length() <= rest.length(); ++i)
+        {
+            i += FindElement(rest.data() + i, rest.length() - needle.length() + 1 - i, needle[0]);
+            if (i + needle.length() <= rest.length() && rest.compare(i + 1, needle.length() - 1, needle, 1, needle.length() - 1) == 0)
+            {
+                at = i;
+                break;
+            }
+        }
+    }
+    return at == npos ? npos : from + at;
+}
+
+///
+/// Aho-Corasick: an automaton over the bytes of many needles, which finds all of them in a single pass over the
+/// text, one table lookup a byte. Every state has all 256 transitions, so the pass never backtracks.
+/// Wide characters are matched by their bytes, and a match only counts where it ends on a character boundary
+template <typename CharT> class SubstringSet
+{
+public:
+    explicit SubstringSet(const std::vector<std::basic_string_view<CharT>>& needles)
+    {
+        AddState();
+        m_ends.reserve(needles.size());
+        for (const auto& needle : needles)
+        {
+            std::uint32_t state = 0;
+            const auto* bytes = reinterpret_cast<const unsigned char*>(needle.data());
+            for (size_t i = 0; i < needle.length() * sizeof(CharT); ++i)
+            {
+                const size_t transition = size_t{ state } * 256 + bytes[i];
+                if (m_next[transition] == 0)
+                {
+                    // Not through a reference: adding the state grows m_next
+                    const std::uint32_t added = AddState();
+                    m_next[transition] = added;
+                }
+                state = m_next[transition];
+            }
+            m_ends.push_back(state);
+            m_terminal[state] = 1;
+        }
+        Link();
+    }
+
+    /// The states of an automaton for `needles`, to check against MaxSubstringStates before building one
+    static size_t States(const std::vector<std::basic_string_view<CharT>>& needles) noexcept
+    {
+        size_t states = 1;
+        for (const auto& needle : needles)
+        {
+            states += needle.length() * sizeof(CharT);
+        }
+        return states;
+    }
+
+    /// Whether each needle is in `text`; stops reading as soon as all of them have been found
+    [[nodiscard]] std::vector<bool> Find(const std::basic_string_view<CharT> text) const
+    {
+        std::vector<char> found(m_output.size());
+        found[0] = 1;
+        size_t remaining = 0;
+        for (std::uint32_t state = 1; state < m_terminal.size(); ++state)
+        {
+            remaining += m_terminal[state];
+        }
+        const auto* bytes = reinterpret_cast<const unsigned char*>(text.data());
+        const size_t count = text.length() * sizeof(CharT);
+        std::uint32_t state = 0;
+        for (size_t i = 0; i < count && remaining != 0; ++i)
+        {
+            state = m_next[size_t{ state } * 256 + bytes[i]];
+            if (m_output[state] != 0 && (i + 1) % sizeof(CharT) == 0)
+            {
+                // The needles that end here, longest first; once one has been found, so have those after it
+                for (std::uint32_t end = m_output[state]; end != 0 && found[end] == 0; end = m_output[m_fail[end]])
+                {
+                    found[end] = 1;
+                    --remaining;
+                }
+            }
+        }
+        std::vector<bool> result;
+        result.reserve(m_ends.size());
+        for (const std::uint32_t end : m_ends)
+        {
+            result.push_back(found[end] != 0);
+        }
+        return result;
+    }
+
+private:
+    std::uint32_t AddState()
+    {
+        m_next.resize(m_next.size() + 256);
+        m_fail.push_back(0);
+        m_output.push_back(0);
+        m_terminal.push_back(0);
+        return static_cast<std::uint32_t>(m_fail.size() - 1);
+    }
+
+    // Breadth first, so each state's fail state, which is shallower, is done before it: fills in the fail states,
+    // the missing transitions from them, and the nearest needle end on the fail chain of each state
+    void Link()
+    {
+        std::vector<std::uint32_t> queue;
+        queue.reserve(m_fail.size());
+        for (size_t byte = 0; byte < 256; ++byte)
+        {
+            if (const std::uint32_t child = m_next[byte]; child != 0)
+            {
+                queue.push_back(child);
+            }
+        }
+        for (size_t head = 0; head < queue.size(); ++head)
+        {
+            const std::uint32_t state = queue[head];
+            m_output[state] = m_terminal[state] != 0 ? state : m_output[m_fail[state]];
+            for (size_t byte = 0; byte < 256; ++byte)
+            {
+                std::uint32_t& next = m_next[size_t{ state } * 256 + byte];
+                const std::uint32_t fallback = m_next[size_t{ m_fail[state] } * 256 + byte];
+                if (next != 0)
+                {
+                    m_fail[next] = fallback;
+                    queue.push_back(next);
+                }
+                else
+                {
+                    next = fallback;
+                }
+            }
+        }
+    }
+
+    std::vector<std::uint32_t> m_next;
+    std::vector<std::uint32_t> m_fail;
+    // The deepest state on the fail chain of each, itself included, where a needle ends; 0 for none
+    std::vector<std::uint32_t> m_output;
+    std::vector<char> m_terminal;
+    // Where each needle ends
+    std::vector<std::uint32_t> m_ends;
+};
+
+///
+/// Simple case folding, from Unicode 14's CaseFolding.txt (statuses C and S), without ASCII: every `stride`th code
+/// point from `first` to `last` folds to itself plus `delta`. Sorted by `first`
+struct CaseFoldRange
+{
+    char32_t first;
+    char32_t last;
+    std::int32_t delta;
+    std::uint8_t stride;
+};
+
+inline constexpr CaseFoldRange CaseFoldRanges[] = {
+    { 0x00B5, 0x00B5, 775, 1 }, { 0x00C0, 0x00D6, 32, 1 }, { 0x00D8, 0x00DE, 32, 1 }, { 0x0100, 0x012E, 1, 2 },
+    { 0x0132, 0x0136, 1, 2 }, { 0x0139, 0x0147, 1, 2 }, { 0x014A, 0x0176, 1, 2 }, { 0x0178, 0x0178, -121, 1 },
+    { 0x0179, 0x017D, 1, 2 }, { 0x017F, 0x017F, -268, 1 }, { 0x0181, 0x0181, 210, 1 }, { 0x0182, 0x0184, 1, 2 },
+    { 0x0186, 0x0186, 206, 1 }, { 0x0187, 0x0187, 1, 1 }, { 0x0189, 0x018A, 205, 1 }, { 0x018B, 0x018B, 1, 1 },
+    { 0x018E, 0x018E, 79, 1 }, { 0x018F, 0x018F, 202, 1 }, { 0x0190, 0x0190, 203, 1 }, { 0x0191, 0x0191, 1, 1 },
+    { 0x0193, 0x0193, 205, 1 }, { 0x0194, 0x0194, 207, 1 }, { 0x0196, 0x0196, 211, 1 }, { 0x0197, 0x0197, 209, 1 },
+    { 0x0198, 0x0198, 1, 1 }, { 0x019C, 0x019C, 211, 1 }, { 0x019D, 0x019D, 213, 1 }, { 0x019F, 0x019F, 214, 1 },
+    { 0x01A0, 0x01A4, 1, 2 }, { 0x01A6, 0x01A6, 218, 1 }, { 0x01A7, 0x01A7, 1, 1 }, { 0x01A9, 0x01A9, 218, 1 },
+    { 0x01AC, 0x01AC, 1, 1 }, { 0x01AE, 0x01AE, 218, 1 }, { 0x01AF, 0x01AF, 1, 1 }, { 0x01B1, 0x01B2, 217, 1 },
+    { 0x01B3, 0x01B5, 1, 2 }, { 0x01B7, 0x01B7, 219, 1 }, { 0x01B8, 0x01B8, 1, 1 }, { 0x01BC, 0x01BC, 1, 1 },
+    { 0x01C4, 0x01C4, 2, 1 }, { 0x01C5, 0x01C5, 1, 1 }, { 0x01C7, 0x01C7, 2, 1 }, { 0x01C8, 0x01C8, 1, 1 },
+    { 0x01CA, 0x01CA, 2, 1 }, { 0x01CB, 0x01DB, 1, 2 }, { 0x01DE, 0x01EE, 1, 2 }, { 0x01F1, 0x01F1, 2, 1 },
+    { 0x01F2, 0x01F4, 1, 2 }, { 0x01F6, 0x01F6, -97, 1 }, { 0x01F7, 0x01F7, -56, 1 }, { 0x01F8, 0x021E, 1, 2 },
+    { 0x0220, 0x0220, -130, 1 }, { 0x0222, 0x0232, 1, 2 }, { 0x023A, 0x023A, 10795, 1 }, { 0x023B, 0x023B, 1, 1 },
+    { 0x023D, 0x023D, -163, 1 }, { 0x023E, 0x023E, 10792, 1 }, { 0x0241, 0x0241, 1, 1 },
+    { 0x0243, 0x0243, -195, 1 }, { 0x0244, 0x0244, 69, 1 }, { 0x0245, 0x0245, 71, 1 }, { 0x0246, 0x024E, 1, 2 },
+    { 0x0345, 0x0345, 116, 1 }, { 0x0370, 0x0372, 1, 2 }, { 0x0376, 0x0376, 1, 1 }, { 0x037F, 0x037F, 116, 1 },
+    { 0x0386, 0x0386, 38, 1 }, { 0x0388, 0x038A, 37, 1 }, { 0x038C, 0x038C, 64, 1 }, { 0x038E, 0x038F, 63, 1 },
+    { 0x0391, 0x03A1, 32, 1 }, { 0x03A3, 0x03AB, 32, 1 }, { 0x03C2, 0x03C2, 1, 1 }, { 0x03CF, 0x03CF, 8, 1 },
+    { 0x03D0, 0x03D0, -30, 1 }, { 0x03D1, 0x03D1, -25, 1 }, { 0x03D5, 0x03D5, -15, 1 }, { 0x03D6, 0x03D6, -22, 1 },
+    { 0x03D8, 0x03EE, 1, 2 }, { 0x03F0, 0x03F0, -54, 1 }, { 0x03F1, 0x03F1, -48, 1 }, { 0x03F4, 0x03F4, -60, 1 },
+    { 0x03F5, 0x03F5, -64, 1 }, { 0x03F7, 0x03F7, 1, 1 }, { 0x03F9, 0x03F9, -7, 1 }, { 0x03FA, 0x03FA, 1, 1 },
+    { 0x03FD, 0x03FF, -130, 1 }, { 0x0400, 0x040F, 80, 1 }, { 0x0410, 0x042F, 32, 1 }, { 0x0460, 0x0480, 1, 2 },
+    { 0x048A, 0x04BE, 1, 2 }, { 0x04C0, 0x04C0, 15, 1 }, { 0x04C1, 0x04CD, 1, 2 }, { 0x04D0, 0x052E, 1, 2 },
+    { 0x0531, 0x0556, 48, 1 }, { 0x10A0, 0x10C5, 7264, 1 }, { 0x10C7, 0x10C7, 7264, 1 },
+    { 0x10CD, 0x10CD, 7264, 1 }, { 0x13F8, 0x13FD, -8, 1 }, { 0x1C80, 0x1C80, -6222, 1 },
+    { 0x1C81, 0x1C81, -6221, 1 }, { 0x1C82, 0x1C82, -6212, 1 }, { 0x1C83, 0x1C84, -6210, 1 },
+    { 0x1C85, 0x1C85, -6211, 1 }, { 0x1C86, 0x1C86, -6204, 1 }, { 0x1C87, 0x1C87, -6180, 1 },
+    { 0x1C88, 0x1C88, 35267, 1 }, { 0x1C90, 0x1CBA, -3008, 1 }, { 0x1CBD, 0x1CBF, -3008, 1 },
+    { 0x1E00, 0x1E94, 1, 2 }, { 0x1E9B, 0x1E9B, -58, 1 }, { 0x1E9E, 0x1E9E, -7615, 1 }, { 0x1EA0, 0x1EFE, 1, 2 },
+    { 0x1F08, 0x1F0F, -8, 1 }, { 0x1F18, 0x1F1D, -8, 1 }, { 0x1F28, 0x1F2F, -8, 1 }, { 0x1F38, 0x1F3F, -8, 1 },
+    { 0x1F48, 0x1F4D, -8, 1 }, { 0x1F59, 0x1F5F, -8, 2 }, { 0x1F68, 0x1F6F, -8, 1 }, { 0x1F88, 0x1F8F, -8, 1 },
+    { 0x1F98, 0x1F9F, -8, 1 }, { 0x1FA8, 0x1FAF, -8, 1 }, { 0x1FB8, 0x1FB9, -8, 1 }, { 0x1FBA, 0x1FBB, -74, 1 },
+    { 0x1FBC, 0x1FBC, -9, 1 }, { 0x1FBE, 0x1FBE, -7173, 1 }, { 0x1FC8, 0x1FCB, -86, 1 }, { 0x1FCC, 0x1FCC, -9, 1 },
+    { 0x1FD8, 0x1FD9, -8, 1 }, { 0x1FDA, 0x1FDB, -100, 1 }, { 0x1FE8, 0x1FE9, -8, 1 }, { 0x1FEA, 0x1FEB, -112, 1 },
+    { 0x1FEC, 0x1FEC, -7, 1 }, { 0x1FF8, 0x1FF9, -128, 1 }, { 0x1FFA, 0x1FFB, -126, 1 }, { 0x1FFC, 0x1FFC, -9, 1 },
+    { 0x2126, 0x2126, -7517, 1 }, { 0x212A, 0x212A, -8383, 1 }, { 0x212B, 0x212B, -8262, 1 },
+    { 0x2132, 0x2132, 28, 1 }, { 0x2160, 0x216F, 16, 1 }, { 0x2183, 0x2183, 1, 1 }, { 0x24B6, 0x24CF, 26, 1 },
+    { 0x2C00, 0x2C2F, 48, 1 }, { 0x2C60, 0x2C60, 1, 1 }, { 0x2C62, 0x2C62, -10743, 1 },
+    { 0x2C63, 0x2C63, -3814, 1 }, { 0x2C64, 0x2C64, -10727, 1 }, { 0x2C67, 0x2C6B, 1, 2 },
+    { 0x2C6D, 0x2C6D, -10780, 1 }, { 0x2C6E, 0x2C6E, -10749, 1 }, { 0x2C6F, 0x2C6F, -10783, 1 },
+    { 0x2C70, 0x2C70, -10782, 1 }, { 0x2C72, 0x2C72, 1, 1 }, { 0x2C75, 0x2C75, 1, 1 },
+    { 0x2C7E, 0x2C7F, -10815, 1 }, { 0x2C80, 0x2CE2, 1, 2 }, { 0x2CEB, 0x2CED, 1, 2 }, { 0x2CF2, 0x2CF2, 1, 1 },
+    { 0xA640, 0xA66C, 1, 2 }, { 0xA680, 0xA69A, 1, 2 }, { 0xA722, 0xA72E, 1, 2 }, { 0xA732, 0xA76E, 1, 2 },
+    { 0xA779, 0xA77B, 1, 2 }, { 0xA77D, 0xA77D, -35332, 1 }, { 0xA77E, 0xA786, 1, 2 }, { 0xA78B, 0xA78B, 1, 1 },
+    { 0xA78D, 0xA78D, -42280, 1 }, { 0xA790, 0xA792, 1, 2 }, { 0xA796, 0xA7A8, 1, 2 },
+    { 0xA7AA, 0xA7AA, -42308, 1 }, { 0xA7AB, 0xA7AB, -42319, 1 }, { 0xA7AC, 0xA7AC, -42315, 1 },
+    { 0xA7AD, 0xA7AD, -42305, 1 }, { 0xA7AE, 0xA7AE, -42308, 1 }, { 0xA7B0, 0xA7B0, -42258, 1 },
+    { 0xA7B1, 0xA7B1, -42282, 1 }, { 0xA7B2, 0xA7B2, -42261, 1 }, { 0xA7B3, 0xA7B3, 928, 1 },
+    { 0xA7B4, 0xA7C2, 1, 2 }, { 0xA7C4, 0xA7C4, -48, 1 }, { 0xA7C5, 0xA7C5, -42307, 1 },
+    { 0xA7C6, 0xA7C6, -35384, 1 }, { 0xA7C7, 0xA7C9, 1, 2 }, { 0xA7D0, 0xA7D0, 1, 1 }, { 0xA7D6, 0xA7D8, 1, 2 },
+    { 0xA7F5, 0xA7F5, 1, 1 }, { 0xAB70, 0xABBF, -38864, 1 }, { 0xFF21, 0xFF3A, 32, 1 }, { 0x10400, 0x10427, 40, 1 },
+    { 0x104B0, 0x104D3, 40, 1 }, { 0x10570, 0x1057A, 39, 1 }, { 0x1057C, 0x1058A, 39, 1 },
+    { 0x1058C, 0x10592, 39, 1 }, { 0x10594, 0x10595, 39, 1 }, { 0x10C80, 0x10CB2, 64, 1 },
+    { 0x118A0, 0x118BF, 32, 1 }, { 0x16E40, 0x16E5F, 32, 1 }, { 0x1E900, 0x1E921, 34, 1 },
+};
+
+///
+/// `c` under simple case folding
+inline char32_t FoldCase(const char32_t c) noexcept
+{
+    if (c < 0x80)
+    {
+        return c >= 'A' && c <= 'Z' ? c + 0x20 : c;
+    }
+    // The last range starting at or before `c`
+    size_t low = 0;
+    size_t high = sizeof(CaseFoldRanges) / sizeof(CaseFoldRanges[0]);
+    while (low < high)
+    {
+        const size_t middle = low + (high - low) / 2;
+        if (CaseFoldRanges[middle].first <= c)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    if (low == 0)
+    {
+        return c;
+    }
+    const CaseFoldRange& range = CaseFoldRanges[low - 1];
+    return c <= range.last && (c - range.first) % range.stride == 0 ? static_cast<char32_t>(c + range.delta) : c;
+}
+
+// Bytes that are not valid UTF-8, and unpaired surrogates, are read as themselves plus this, past the last code point,
+// so that they only ever equal themselves
+constexpr char32_t UndecodedBase = 0x110000;
+
+///
+/// The code point of UTF-8 `text` at `at`, moving `at` past it
+inline char32_t NextCodePoint(const std::string_view text, size_t& at) noexcept
+{
+    const auto lead = static_cast<unsigned char>(text[at]);
+    const size_t length = lead < 0x80 ? 1 : lead < 0xC0 ? 0 : lead < 0xE0 ? 2 : lead < 0xF0 ? 3 : lead < 0xF8 ? 4 : 0;
+    if (length == 1 || length == 0 || at + length > text.length())
+    {
+        ++at;
+        return length == 1 ? lead : UndecodedBase + lead;
+    }
+    char32_t code = lead & (0x7F >> length);
+    for (size_t i = 1; i < length; ++i)
+    {
+        const auto next = static_cast<unsigned char>(text[at + i]);
+        if ((next & 0xC0) != 0x80)
+        {
+            ++at;
+            return UndecodedBase + lead;
+        }
+        code = code << 6 | (next & 0x3F);
+    }
+    at += length;
+    return code;
+}
+
+///
+/// The code point of UTF-16 (Windows) or UTF-32 `text` at `at`, moving `at` past it
+inline char32_t NextCodePoint(const std::wstring_view text, size_t& at) noexcept
+{
+    const auto unit = static_cast<char32_t>(static_cast<std::make_unsigned_t<wchar_t>>(text[at++]));
+    if constexpr (sizeof(wchar_t) == 2)
+    {
+        if (unit >= 0xD800 && unit <= 0xDFFF)
+        {
+            const char32_t low = at < text.length() ? static_cast<char32_t>(static_cast<std::make_unsigned_t<wchar_t>>(text[at])) : 0;
+            if (unit >= 0xDC00 || low < 0xDC00 || low > 0xDFFF)
+            {
+                return UndecodedBase + unit;
+            }
+            ++at;
+            return 0x10000 + ((unit - 0xD800) << 10) + (low - 0xDC00);
+        }
+    }
+    return unit;
+}
+
+inline size_t FoldedAsciiPrefixScalar(const unsigned char* lhs, const unsigned char* rhs, const size_t count) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (((lhs[i] | rhs[i]) & 0x80) != 0 || FoldCase(lhs[i]) != FoldCase(rhs[i]))
+        {
+            return i;
+        }
+    }
+    return count;
+}
+
+#ifdef CHAMOIS_SIMD_X86
+// 'A' to 'Z' get 0x20 added; bytes from 0x80 up are negative, so are never taken for capitals
+inline Bytes16 FoldAsciiSse2(const Bytes16 bytes) noexcept
+{
+    const Bytes16 capital = And(Greater(bytes, Splat16('A' - 1)), Greater(Splat16('Z' + 1), bytes));
+    return Or(bytes, And(capital, Splat16(0x20)));
+}
+
+inline size_t FoldedAsciiPrefixSse2(const unsigned char* lhs, const unsigned char* rhs, const size_t count) noexcept
+{
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const Bytes16 left = Load16(lhs + i);
+        const Bytes16 right = Load16(rhs + i);
+        const std::uint32_t equal = Mask(Equal(FoldAsciiSse2(left), FoldAsciiSse2(right)));
+        const std::uint32_t stop = (equal ^ 0xFFFFu) | Mask(Or(left, right));
+        if (stop != 0)
+        {
+            return i + static_cast<size_t>(std::countr_zero(stop));
+        }
+    }
+    return i + FoldedAsciiPrefixScalar(lhs + i, rhs + i, count - i);
+}
+
+CHAMOIS_TARGET_AVX2 inline Bytes32 FoldAsciiAvx2(const Bytes32 bytes) noexcept
+{
+    const Bytes32 capital = And(Greater(bytes, Splat32('A' - 1)), Greater(Splat32('Z' + 1), bytes));
+    return Or(bytes, And(capital, Splat32(0x20)));
+}
+
+CHAMOIS_TARGET_AVX2 inline size_t FoldedAsciiPrefixAvx2(const unsigned char* lhs, const unsigned char* rhs,
+    const size_t count) noexcept
+{
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32)
+    {
+        const Bytes32 left = Load32(lhs + i);
+        const Bytes32 right = Load32(rhs + i);
+        const std::uint32_t equal = Mask(Equal(FoldAsciiAvx2(left), FoldAsciiAvx2(right)));
+        const std::uint32_t stop = ~equal | Mask(Or(left, right));
+        if (stop != 0)
+        {
+            return i + static_cast<size_t>(std::countr_zero(stop));
+        }
+    }
+    return i + FoldedAsciiPrefixSse2(lhs + i, rhs + i, count - i);
+}
+#endif
+
+///
+/// How many of the first `count` bytes of `lhs` and `rhs` are ASCII, and equal ignoring case
+inline size_t FoldedAsciiPrefix(const unsigned char* lhs, const unsigned char* rhs, const size_t count) noexcept
+{
+#ifdef CHAMOIS_SIMD_X86
+    static const bool avx2 = HasAvx2();
+    return avx2 ? FoldedAsciiPrefixAvx2(lhs, rhs, count) : FoldedAsciiPrefixSse2(lhs, rhs, count);
+#else
+    return FoldedAsciiPrefixScalar(lhs, rhs, count);
+#endif
+}
+
+///
+/// Compares `text` from `at` with `other` from `other_at`, ignoring case, and moves both past the code points that
+/// are equal. Narrow strings are compared 16 or 32 ASCII bytes at a time, and a code point at a time only where there
+/// are others; `at` and `other_at` may then end up apart, as 'K' (the Kelvin sign) takes three bytes and 'k' one
+template <typename CharT>
+void SkipEqualIgnoringCase(const std::basic_string_view<CharT> text, size_t& at, const std::basic_string_view<CharT> other,
+    size_t& other_at) noexcept
+{
+    while (at < text.length() && other_at < other.length())
+    {
+        if constexpr (sizeof(CharT) == 1)
+        {
+            const size_t rest = text.length() - at < other.length() - other_at ? text.length() - at : other.length() - other_at;
+            const size_t equal = FoldedAsciiPrefix(reinterpret_cast<const unsigned char*>(text.data() + at),
+                reinterpret_cast<const unsigned char*>(other.data() + other_at), rest);
+            at += equal;
+            other_at += equal;
+            if (equal == rest)
+            {
+                return;
+            }
+        }
+        size_t next = at;
+        size_t other_next = other_at;
+        if (FoldCase(NextCodePoint(text, next)) != FoldCase(NextCodePoint(other, other_next)))
+        {
+            return;
+        }
+        at = next;
+        other_at = other_next;
+    }
+}
+
+inline size_t FindCandidateBytesScalar(const unsigned char* text, const size_t count, const unsigned char lower,
+    const unsigned char upper, const unsigned char other) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (text[i] == lower || text[i] == upper || text[i] == other)
+        {
+            return i;
+        }
+    }
+    return count;
+}
+
+#ifdef CHAMOIS_SIMD_X86
+inline size_t FindCandidateBytesSse2(const unsigned char* text, const size_t count, const unsigned char lower,
+    const unsigned char upper, const unsigned char other) noexcept
+{
+    const Bytes16 lowers = Splat16(lower);
+    const Bytes16 uppers = Splat16(upper);
+    const Bytes16 others = Splat16(other);
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const Bytes16 bytes = Load16(text + i);
+        const std::uint32_t found = Mask(Or(Or(Equal(bytes, lowers), Equal(bytes, uppers)), Equal(bytes, others)));
+        if (found != 0)
+        {
+            return i + static_cast<size_t>(std::countr_zero(found));
+        }
+    }
+    return i + FindCandidateBytesScalar(text + i, count - i, lower, upper, other);
+}
+
+CHAMOIS_TARGET_AVX2 inline size_t FindCandidateBytesAvx2(const unsigned char* text, const size_t count,
+    const unsigned char lower, const unsigned char upper, const unsigned char other) noexcept
+{
+    const Bytes32 lowers = Splat32(lower);
+    const Bytes32 uppers = Splat32(upper);
+    const Bytes32 others = Splat32(other);
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32)
+    {
+        const Bytes32 bytes = Load32(text + i);
+        const std::uint32_t found = Mask(Or(Or(Equal(bytes, lowers), Equal(bytes, uppers)), Equal(bytes, others)));
+        if (found != 0)
+        {
+            return i + static_cast<size_t>(std::countr_zero(found));
+        }
+    }
+    return i + FindCandidateBytesSse2(text + i, count - i, lower, upper, other);
+}
+#endif
+
+///
+/// The index of the first of the `count` bytes of `text` that is `lower`, `upper` or `other`, or `count`
+inline size_t FindCandidateBytes(const unsigned char* text, const size_t count, const unsigned char lower,
+    const unsigned char upper, const unsigned char other) noexcept
+{
+#ifdef CHAMOIS_SIMD_X86
+    static const bool avx2 = HasAvx2();
+    return avx2 ? FindCandidateBytesAvx2(text, count, lower, upper, other)
+                : FindCandidateBytesSse2(text, count, lower, upper, other);
+#else
+    return FindCandidateBytesScalar(text, count, lower, upper, other);
+#endif
+}
+
+///
+/// The index of the first occurrence of `needle` in `haystack`, ignoring case, or npos.
+/// Where the needle starts with an ASCII character, narrow strings are only compared where a byte could start it:
+/// its lower and upper case, and the lead byte of the one other character folding to it ('s' and 'k' have one each)
+template <typename CharT>
+size_t FindSubstringIgnoringCase(const std::basic_string_view<CharT> haystack, const std::basic_string_view<CharT> needle) noexcept
+{
+    if (needle.empty())
+    {
+        return 0;
+    }
+    size_t needle_at = 0;
+    const char32_t first = FoldCase(NextCodePoint(needle, needle_at));
+    const auto matches_at = [&](const size_t at) {
+        size_t end = at;
+        size_t needle_end = 0;
+        SkipEqualIgnoringCase(haystack, end, needle, needle_end);
+        return needle_end == needle.length();
+    };
+    if constexpr (sizeof(CharT) == 1)
+    {
+        if (first < 0x80)
+        {
+            const auto lower = static_cast<unsigned char>(first);
+            const auto upper = static_cast<unsigned char>(lower >= 'a' && lower <= 'z' ? lower - 0x20 : lower);
+            // The lead bytes of U+017F (long s) and U+212A (Kelvin sign)
+            const auto other = static_cast<unsigned char>(lower == 's' ? 0xC5 : lower == 'k' ? 0xE2 : lower);
+            const auto* bytes = reinterpret_cast<const unsigned char*>(haystack.data());
+            for (size_t at = 0; at < haystack.length(); ++at)
+            {
+                at += FindCandidateBytes(bytes + at, haystack.length() - at, lower, upper, other);
+                if (at < haystack.length() && matches_at(at))
+                {
+                    return at;
+                }
+            }
+            return haystack.npos;
+        }
+    }
+    for (size_t at = 0; at < haystack.length();)
+    {
+        size_t next = at;
+        if (FoldCase(NextCodePoint(haystack, next)) == first && matches_at(at))
+        {
+            return at;
+        }
+        at = next;
+    }
+    return haystack.npos;
+}
+
+///
+/// A wildcard pattern, where `*` matches any run of characters (none included) and `?` any one character.
+/// Matched Shift-And style, with a bit for each position between the other characters of the pattern: the text is
+/// read once, a character at a time, moving the bits of every position it can have reached on together, and a `*`
+/// keeps the bit of its position set. So matching takes time linear in the text whatever the pattern, where a
+/// backtracking matcher takes time exponential in the number of `*`s over `*a*a*a*a*b` and a long run of 'a's.
+/// Characters are code points, so `?` matches an 'e' with an acute accent that takes two bytes of UTF-8.
+/// Short patterns are matched without allocating
+template <typename CharT> class Wildcard
+{
+public:
+    using view_type = std::basic_string_view<CharT>;
+
+    /// `literal` false always builds the automaton, even for a pattern that is a literal with a `*` at either end
+    Wildcard(const view_type pattern, const bool ignore_case, const bool literal = true)
+        : m_pattern(pattern), m_ignore_case(ignore_case)
+    {
+        // Without `?`, and with `*` only at the ends, the pattern is the text, or its start, end, or a substring of it
+        if (literal && !ignore_case && pattern.find(CharT('?')) == view_type::npos)
+        {
+            const size_t leading = !pattern.empty() && pattern.front() == CharT('*') ? 1 : 0;
+            const size_t trailing = pattern.length() > 1 && pattern.back() == CharT('*') ? 1 : 0;
+            const view_type middle = pattern.substr(leading, pattern.length() - leading - trailing);
+            if (middle.find(CharT('*')) == view_type::npos)
+            {
+                m_literal = middle;
+                m_anchored_start = leading == 0;
+                m_anchored_end = trailing == 0;
+                m_is_literal = true;
+                return;
+            }
+        }
+
+        // A row for each distinct character: ASCII ones by `m_ascii`, in the order they come, then the others sorted
+        size_t rows = Characters;
+        size_t positions = 0;
+        for (size_t at = 0; at < pattern.length();)
+        {
+            const char32_t c = NextCharacter(pattern, at);
+            if (c == '*')
+            {
+                continue;
+            }
+            ++positions;
+            if (c >= 0x80)
+            {
+                m_characters.push_back(c);
+            }
+            else if (c != '?' && m_ascii[c] == Any)
+            {
+                m_ascii[c] = static_cast<std::uint8_t>(rows++);
+            }
+        }
+        if (m_ignore_case)
+        {
+            for (char32_t c = 'A'; c <= 'Z'; ++c)
+            {
+                m_ascii[c] = m_ascii[c + 0x20];
+            }
+        }
+        std::sort(m_characters.begin(), m_characters.end());
+        m_characters.erase(std::unique(m_characters.begin(), m_characters.end()), m_characters.end());
+        m_others = rows;
+        m_final = positions;
+        m_words = positions / 64 + 1;
+        m_masks.assign((rows + m_characters.size()) * m_words, 0);
+
+        // Position p moves on to p + 1 over the pattern's character at p, and over any character if that is a `?`
+        positions = 0;
+        for (size_t at = 0; at < pattern.length();)
+        {
+            const char32_t c = NextCharacter(pattern, at);
+            const size_t row = c == '*' ? Loops : c == '?' ? Any : Row(c);
+            const size_t position = c == '*' ? positions : ++positions;
+            m_masks[row * m_words + position / 64] |= std::uint64_t{ 1 } << (position % 64);
+        }
+        for (size_t row = Characters; row < m_others + m_characters.size(); ++row)
+        {
+            for (size_t word = 0; word < m_words; ++word)
+            {
+                m_masks[row * m_words + word] |= m_masks[Any * m_words + word];
+            }
+        }
+    }
+
+    /// Whether the whole of `text` matches
+    [[nodiscard]] bool Matches(const view_type text) const
+    {
+        if (m_is_literal)
+        {
+            if (m_anchored_start)
+            {
+                return m_anchored_end ? text == m_literal : text.starts_with(m_literal);
+            }
+            return m_anchored_end ? text.ends_with(m_literal) : FindSubstring(text, m_literal) != view_type::npos;
+        }
+        return Run(text) == view_type::npos;
+    }
+
+    ///
+    /// Failure path only: the index of the character of `text` that no match gets past, or its length when it ends
+    /// before the pattern does
+    [[nodiscard]] size_t Mismatch(const view_type text) const
+    {
+        return m_is_literal ? Wildcard(m_pattern, m_ignore_case, false).Run(text) : Run(text);
+    }
+
+private:
+    // Rows of `m_masks`, of `m_words` words each, the positions that move on over a character: over any (those of
+    // `?`), over any while staying set too (those of `*`), then over each character of the pattern, and `?`
+    static constexpr size_t Any = 0;
+    static constexpr size_t Loops = 1;
+    static constexpr size_t Characters = 2;
+
+    char32_t Fold(const char32_t c) const noexcept
+    {
+        return m_ignore_case ? FoldCase(c) : c;
+    }
+
+    // The character of `pattern` at `at`, folded when ignoring case, moving `at` past it
+    char32_t NextCharacter(const view_type pattern, size_t& at) const noexcept
+    {
+        if (const auto unit = static_cast<std::make_unsigned_t<CharT>>(pattern[at]); unit < 0x80)
+        {
+            ++at;
+            return m_ignore_case && unit >= 'A' && unit <= 'Z' ? unit + 0x20 : unit;
+        }
+        return Fold(NextCodePoint(pattern, at));
+    }
+
+    // The row of `c`, folded already, or `Any` when it is not in the pattern
+    size_t Row(const char32_t c) const noexcept
+    {
+        if (c < 0x80)
+        {
+            return m_ascii[c];
+        }
+        const auto found = std::lower_bound(m_characters.begin(), m_characters.end(), c);
+        return found != m_characters.end() && *found == c ? m_others + static_cast<size_t>(found - m_characters.begin())
+                                                         : Any;
+    }
+
+    // The row of the character of `text` at `at`, moving `at` past it; ASCII is neither decoded nor folded
+    size_t NextRow(const view_type text, size_t& at) const noexcept
+    {
+        if (const auto unit = static_cast<std::make_unsigned_t<CharT>>(text[at]); unit < 0x80)
+        {
+            ++at;
+            return m_ascii[unit];
+        }
+        return Row(Fold(NextCodePoint(text, at)));
+    }
+
+    // npos if the whole of `text` matches, otherwise where it stops matching as for `Mismatch`; a `*` at the end of
+    // the pattern matches the rest of the text as soon as it is reached
+    size_t Run(const view_type text) const
+    {
+        const std::uint64_t* loops = &m_masks[Loops * m_words];
+        const size_t final_word = m_final / 64;
+        const std::uint64_t final = std::uint64_t{ 1 } << (m_final % 64);
+        const bool final_loops = (loops[final_word] & final) != 0;
+        if (m_words == 1)
+        {
+            std::uint64_t states = 1;
+            for (size_t at = 0; at < text.length();)
+            {
+                const size_t start = at;
+                states = ((states << 1) & m_masks[NextRow(text, at)]) | (states & *loops);
+                if (states == 0)
+                {
+                    return start;
+                }
+                if (final_loops && (states & final) != 0)
+                {
+                    return view_type::npos;
+                }
+            }
+            return (states & final) != 0 ? view_type::npos : text.length();
+        }
+        std::vector<std::uint64_t> states(m_words, 0);
+        std::vector<std::uint64_t> next(m_words, 0);
+        states[0] = 1;
+        for (size_t at = 0; at < text.length();)
+        {
+            const size_t start = at;
+            const std::uint64_t* accepts = &m_masks[NextRow(text, at) * m_words];
+            std::uint64_t carry = 0;
+            std::uint64_t reached = 0;
+            for (size_t word = 0; word < m_words; ++word)
+            {
+                next[word] = (((states[word] << 1) | carry) & accepts[word]) | (states[word] & loops[word]);
+                carry = states[word] >> 63;
+                reached |= next[word];
+            }
+            states.swap(next);
+            if (reached == 0)
+            {
+                return start;
+            }
+            if (final_loops && (states[final_word] & final) != 0)
+            {
+                return view_type::npos;
+            }
+        }
+        return (states[final_word] & final) != 0 ? view_type::npos : text.length();
+    }
+
+    view_type m_pattern;
+    bool m_ignore_case;
+    bool m_is_literal = false;
+    bool m_anchored_start = false;
+    bool m_anchored_end = false;
+    view_type m_literal;
+    size_t m_final = 0;
+    size_t m_words = 1;
+    // The row of each ASCII character, there being at most 128 of them; `Any` where it is not in the pattern
+    std::array<std::uint8_t, 0x80> m_ascii{};
+    // The first row of `m_characters`, the characters beyond ASCII
+    size_t m_others = Characters;
+    std::array<std::byte, 1024> m_buffer;
+    std::pmr::monotonic_buffer_resource m_arena{ m_buffer.data(), m_buffer.size() };
+    std::pmr::vector<char32_t> m_characters{ &m_arena };
+    std::pmr::vector<std::uint64_t> m_masks{ &m_arena };
+};
+
+///
+/// Failure path only: a short string whole, a long one by its length
+template <typename CharT> std::string DescribeHaystack(const std::basic_string_view<CharT> text)
+{
+    return text.length() <= 2 * CHAMOIS_STRING_CONTEXT ? Describe(text)
+                                                       : "The string of " + std::to_string(text.length()) + " characters";
+}
+
+///
+/// The needles as views; those a range yields by value are copied into `copies` first
+template <typename CharT, typename TNeedles>
+std::vector<std::basic_string_view<CharT>> NeedleViews(const TNeedles& needles,
+    std::deque<std::basic_string<CharT>>& copies)
+{
+    std::vector<std::basic_string_view<CharT>> views;
+    for (auto&& needle : needles)
+    {
+        if constexpr (std::is_lvalue_reference_v<decltype(needle)>)
+        {
+            views.emplace_back(needle);
+        }
+        else
+        {
+            views.emplace_back(copies.emplace_back(needle));
+        }
+    }
+    return views;
+}
+
+///
+/// Failure path only: why `text` does not match the wildcard `pattern`, given where it stops matching
+template <typename CharT>
+std::string DescribeWildcardMismatch(const std::basic_string_view<CharT> text,
+    const std::basic_string_view<CharT> pattern, const size_t at, const char* ignoring)
+{
+    return DescribeHaystack(text) + " does not match the wildcard pattern " + Describe(pattern) + ignoring +
+        (at < text.length() ? ": no match gets past " + DescribePosition(text, at)
+                            : std::string(": the string ends before the pattern does"));
+}
+}    // namespace detail
+
+template <class TAssertImpl, class T, typename TStorage>
+void detail::ShouldStrImpl<TAssertImpl, T, TStorage>::_containFunc(const char* file, const int line, const view_type needle,
+    const std::string_view because) const
+{
+    if (FindSubstring(m_value, needle) == view_type::npos)
+    {
+        TAssertImpl::AssertFail(FailureContext(file, line, because)
+                                    .WithReason(DescribeHaystack(m_value) + " does not contain " + Describe(needle)));
+    }
+}
+
+template <class TAssertImpl, class T, typename TStorage>
+void detail::ShouldStrImpl<TAssertImpl, T, TStorage>::_notContainFunc(const char* file, const int line, const view_type needle,
+    const std::string_view because) const
+{
+    if (const size_t at = FindSubstring(m_value, needle); at != view_type::npos)
+    {
+        TAssertImpl::AssertFail(FailureContext(file, line, because)
+                                    .WithReason(DescribeHaystack(m_value) + " contains " + Describe(needle) +
+                                        ", first at " + DescribePosition(m_value, at)));
+    }
+}
+
+template <class TAssertImpl, class T, typename TStorage>
+template <typename TNeedles>
+void detail::ShouldStrImpl<TAssertImpl, T, TStorage>::_containAllFunc(const char* file, const int line, const TNeedles& needles,
+    const std::string_view because) const
+{
+    std::deque<T> copies;
+    const std::vector<view_type> views = NeedleViews<typename T::value_type>(needles, copies);
+    std::vector<bool> found;
+    if (views.size() > ScannedNeedleLimit && SubstringSet<typename T::value_type>::States(views) <= MaxSubstringStates)
+    {
+        found = SubstringSet<typename T::value_type>(views).Find(m_value);
+    }
+    else
+    {
+        for (const view_type needle : views)
+        {
+            found.push_back(FindSubstring(m_value, needle) != view_type::npos);
+        }
+    }
+    size_t missing = 0;
+    std::string listed;
+    for (size_t i = 0; i < views.size(); ++i)
+    {
+        if (!found[i] && missing++ < CHAMOIS_MISMATCH_INDEX_LIMIT)
+        {
+            listed += (missing == 1 ? "" : ", ") + Describe(views[i]);
+        }
+    }
+    if (missing != 0)
+    {
+        if (missing > CHAMOIS_MISMATCH_INDEX_LIMIT)
+        {
+            listed += ", ... (" + std::to_string(missing - CHAMOIS_MISMATCH_INDEX_LIMIT) + " more)";
+        }
+        TAssertImpl::AssertFail(FailureContext(file, line, because)
+                                    .WithReason(DescribeHaystack(m_value) + " is missing " + std::to_string(missing) +
+                                        " of " + std::to_string(views.size()) + " substrings: " + listed));
+    }
+}
+
+template <class TAssertImpl, class T, typename TStorage>
+void detail::ShouldStrImpl<TAssertImpl, T, TStorage>::_containAllFunc(const char* file, const int line,
+    const std::initializer_list<view_type> needles, const std::string_view because) const
+{
+    _containAllFunc<std::initializer_list<view_type>>(file, line, needles, because);
+}
+
+template <class TAssertImpl, class T, typename TStorage>
+template <typename TNeedles>
+void detail::ShouldStrImpl<TAssertImpl, T, TStorage>::_containInOrderFunc(const char* file, const int line,
+    const TNeedles& needles, const std::string_view because) const
+{
+    // Each needle is looked for from where the one before it ends, so the string is read once in all
+    std::deque<T> copies;
+    const std::vector<view_type> views = NeedleViews<typename T::value_type>(needles, copies);
+    size_t from = 0;
+    for (size_t i = 0; i < views.size(); ++i)
+    {
+        const size_t at = FindSubstring(m_value, views[i], from);
+        if (at == view_type::npos)
+        {
+            TAssertImpl::AssertFail(FailureContext(file, line, because)
+                                        .WithReason(DescribeHaystack(m_value) + " does not contain the " +
+                                            std::to_string(views.size()) + " substrings in order: " + Describe(views[i]) +
+                                            (i == 0 ? std::string(" is not found")
+                                                    : " is not found after " + Describe(views[i - 1]) + ", which ends at " +
+                                                        DescribePosition(m_value, from))));
+            return;
+        }
+        from = at + views[i].length();
+    }
+}
+
+template <class TAssertImpl, class T, typename TStorage>
+void detail::ShouldStrImpl<TAssertImpl, T, TStorage>::_containInOrderFunc(const char* file, const int line,
+    const std::initializer_list<view_type> needles, const std::string_view because) const
+{
+    _containInOrderFunc<std::initializer_list<view_type>>(file, line, needles, because);
+}
+
+template <class TAssertImpl, class T, typename TStorage>
+void detail::ShouldStrImpl<TAssertImpl, T, TStorage>::_beEquivalentToIgnoringCaseFunc(const char* file, const int line,
+    const view_type expected_value, const std::string_view because) const
+{
+    size_t at = 0;
+    size_t expected_at = 0;
+    SkipEqualIgnoringCase(m_value, at, expected_value, expected_at);
+    if (at != m_value.length() || expected_at != expected_value.length())
+    {
+        TAssertImpl::AssertFail(FailureContext(file, line, because)
+                                    .WithReason(DescribeStringMismatch(expected_value, m_value, at,
+                                        "Strings differ, ignoring case,")));
+    }
+}
+
+template <class TAssertImpl, class T, typename TStorage>
+void detail::ShouldStrImpl<TAssertImpl, T, TStorage>::_startsWithIgnoringCaseFunc(const char* file, const int line,
+    const view_type expected_prefix, const std::string_view because) const
+{
+    size_t at = 0;
+    size_t prefix_at = 0;
+    SkipEqualIgnoringCase(m_value, at, expected_prefix, prefix_at);
+    if (prefix_at != expected_prefix.length())
+    {
+        TAssertImpl::AssertFail(FailureContext(file, line, because)
+                                    .WithReason(DescribeHaystack(m_value) + " does not start with " +
+                                        Describe(expected_prefix) + ", ignoring case: it differs from " +
+                                        DescribePosition(m_value, at)));
+    }
+}
+
+template <class TAssertImpl, class T, typename TStorage>
+void detail::ShouldStrImpl<TAssertImpl, T, TStorage>::_containIgnoringCaseFunc(const char* file, const int line,
+    const view_type needle, const std::string_view because) const
+{
+    if (FindSubstringIgnoringCase(m_value, needle) == view_type::npos)
+    {
+        TAssertImpl::AssertFail(FailureContext(file, line, because)
+                                    .WithReason(DescribeHaystack(m_value) + " does not contain " + Describe(needle) +
+                                        ", ignoring case"));
+    }
+}
+
+template <class TAssertImpl, class T, typename TStorage>
+void detail::ShouldStrImpl<TAssertImpl, T, TStorage>::_matchWildcardFunc(const char* file, const int line,
+    const view_type pattern, const std::string_view because) const
+{
+    if (const Wildcard<typename T::value_type> wildcard(pattern, false); !wildcard.Matches(m_value))
+    {
+        TAssertImpl::AssertFail(FailureContext(file, line, because)
+                                    .WithReason(DescribeWildcardMismatch(m_value, pattern, wildcard.Mismatch(m_value), "")));
+    }
+}
+
+template <class TAssertImpl, class T, typename TStorage>
+void detail::ShouldStrImpl<TAssertImpl, T, TStorage>::_notMatchWildcardFunc(const char* file, const int line,
+    const view_type pattern, const std::string_view because) const
+{
+    if (Wildcard<typename T::value_type>(pattern, false).Matches(m_value))
+    {
+        TAssertImpl::AssertFail(FailureContext(file, line, because)
+                                    .WithReason(DescribeHaystack(m_value) + " matches the wildcard pattern " +
+                                        Describe(pattern)));
+    }
+}
+
+template <class TAssertImpl, class T, typename TStorage>
+void detail::ShouldStrImpl<TAssertImpl, T, TStorage>::_matchWildcardIgnoringCaseFunc(const char* file, const int line,
+    const view_type pattern, const std::string_view because) const
+{
+    if (const Wildcard<typename T::value_type> wildcard(pattern, true); !wildcard.Matches(m_value))
+    {
+        TAssertImpl::AssertFail(FailureContext(file, line, because)
+                                    .WithReason(DescribeWildcardMismatch(m_value, pattern, wildcard.Mismatch(m_value),
+                                        ", ignoring case")));
+    }
+}
+}    //namespace evolutional